@@ -0,0 +1,105 @@
+#include "core/AutoStrategyPricer.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/RandomEngine.hpp"
+#include "samplers/MCSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "options/DigitalOption.hpp"
+#include "options/NoOption.hpp"
+#include "market/FlatDiscount.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+
+using clock_type = std::chrono::high_resolution_clock; 
+
+void benchmark_trade(
+    const std::string& name, 
+    const BlackScholesModel& model, 
+    const Option& option, 
+    const Option& control, 
+    double control_mean, 
+    double discount, 
+    std::size_t n_paths
+);
+
+int main()
+{
+    constexpr std::size_t N = 4'000'000; 
+
+    double S = 100.0;
+    double r = 0.05;
+    double T = 1.0;
+    FlatDiscount discount(r); 
+    BlackScholesModel model(S, r, 0.2); 
+    NoOption underlying(T); 
+    double forward = S / discount(T);
+
+    EuropeanOption atm_call(100.0, T, OptionType::Call);
+    EuropeanOption itm_call(70.0, T, OptionType::Call);
+    EuropeanOption otm_call(150.0, T, OptionType::Call);
+    EuropeanOption atm_put(100.0, T, OptionType::Put);
+    DigitalOption digital(105.0, T, 10.0, OptionType::Call);
+
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << "\n========= Automatic Strategy Selection =========\n";
+    std::cout << "Path budget per trade: " << N << "\n";
+
+    benchmark_trade("ATM call", model, atm_call, underlying, forward, discount(T), N);
+    benchmark_trade("ITM call (K=70)", model, itm_call, underlying, forward, discount(T), N);
+    benchmark_trade("OTM call (K=150)", model, otm_call, underlying, forward, discount(T), N);
+    benchmark_trade("ATM put", model, atm_put, underlying, forward, discount(T), N);
+    benchmark_trade("Digital call", model, digital, underlying, forward, discount(T), N);
+
+    return 0;
+}
+
+void benchmark_trade(
+    const std::string& name, 
+    const BlackScholesModel& model, 
+    const Option& option, 
+    const Option& control, 
+    double control_mean, 
+    double discount, 
+    std::size_t n_paths
+)
+{
+    AutoStrategyPricer pricer(model, option, control, control_mean); 
+    RandomEngine rng(1310);
+    auto start = clock_type::now();
+    AutoPricingResult result = pricer.run(n_paths, rng);
+    double auto_time = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    // Plain MC on the same path budget for the realised speedup
+    MCSampler sampler(model, option); 
+    MonteCarloEngine engine(sampler); 
+    RandomEngine plain_rng(1310);
+    start = clock_type::now();
+    OnlineStatistics plain = engine.run(n_paths, plain_rng);
+    double plain_time = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    std::cout << "\n" << name << " (beta " << result.beta << ")\n";
+    std::cout << std::left << std::setw(16) << "  Strategy"
+              << std::setw(14) << "Variance"
+              << std::setw(14) << "ns/sample"
+              << std::setw(14) << "Rel. eff." << '\n';
+    for (const StrategyPilot& pilot : result.pilots)
+        std::cout << "  " << std::setw(14) << strategy_name(pilot.strategy)
+                  << std::setw(14) << pilot.variance
+                  << std::setw(14) << 1e9 * pilot.seconds_per_sample
+                  << std::setw(14) << pilot.efficiency() / result.pilots.front().efficiency()
+                  << '\n';
+
+    double se = result.stats.standard_error(); 
+    double realised = (plain.variance() / plain.count() * plain_time) 
+                      / (se * se * auto_time);
+    std::cout << "  Chosen: " << strategy_name(result.strategy) 
+              << ", price " << discount * result.stats.mean() 
+              << " +/- " << discount * se
+              << " (plain " << discount * plain.mean() 
+              << " +/- " << discount * plain.standard_error() << ")\n";
+    std::cout << "  Expected speedup " << result.expected_speedup 
+              << "x, realised " << realised << "x incl. "
+              << result.pilot_paths << " pilot paths\n";
+}
@@ -0,0 +1,84 @@
+#include "samplers/MCSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/ConvergenceRecorder.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+using clock_type = std::chrono::high_resolution_clock;
+
+int main()
+{
+    BlackScholesModel model(100.0, 0.05, 0.2);
+    EuropeanOption option(100.0, 1.0, OptionType::Call);
+    MCSampler sampler(model, option);
+
+    std::vector<std::size_t> checkpoints = geometric_checkpoints(1000, 4'000'000);
+
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << "\n========= Convergence Recording =========\n";
+    std::cout << "Checkpoints: " << checkpoints.size()
+              << " (" << checkpoints.front() << " to " << checkpoints.back() << " paths)\n\n";
+
+    // One fresh run per checkpoint, as the convergence test used to do
+    std::vector<OnlineStatistics> rerun;
+    auto start = clock_type::now();
+    for (std::size_t n : checkpoints)
+    {
+        MonteCarloEngine engine(sampler);
+        RandomEngine rng(1310);
+        rerun.push_back(engine.run(n, rng));
+    }
+    double rerun_time = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    // A single run snapshotted at every checkpoint
+    start = clock_type::now();
+    std::vector<OnlineStatistics> recorded = record_convergence(sampler, checkpoints, {1310})[0];
+    double record_time = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < checkpoints.size(); ++i)
+    {
+        if (rerun[i].mean() != recorded[i].mean() || rerun[i].m2() != recorded[i].m2())
+            ++mismatches;
+    }
+
+    std::cout << "Rerun per checkpoint: " << rerun_time << " s\n";
+    std::cout << "Single recorded run:  " << record_time << " s\n";
+    std::cout << "Speedup:              " << rerun_time / record_time << "x\n";
+    std::cout << "Mismatched snapshots: " << mismatches << "\n\n";
+
+    // Bands across seeds, one thread per seed
+    std::vector<unsigned int> seeds = {1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317};
+    start = clock_type::now();
+    auto runs = record_convergence(sampler, checkpoints, seeds);
+    double band_time = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    ConvergenceTable table(checkpoints);
+    table.add_band("mc_se", runs);
+    table.write_csv("convergence_bands.csv");
+
+    std::cout << "Band over " << seeds.size() << " seeds: " << band_time << " s\n\n";
+    std::cout << std::left << std::setw(12) << "Paths"
+              << std::setw(12) << "Lo"
+              << std::setw(12) << "Hi" << '\n';
+    for (std::size_t i = 0; i < checkpoints.size(); i += 3)
+    {
+        double lo = runs[0][i].standard_error(), hi = lo;
+        for (const auto& run : runs)
+        {
+            lo = std::min(lo, run[i].standard_error());
+            hi = std::max(hi, run[i].standard_error());
+        }
+        std::cout << std::setw(12) << checkpoints[i]
+                  << std::setw(12) << lo
+                  << std::setw(12) << hi << '\n';
+    }
+
+    return mismatches == 0 ? 0 : 1;
+}
\ No newline at end of file
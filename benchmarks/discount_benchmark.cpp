@@ -0,0 +1,108 @@
+#include "market/FlatDiscount.hpp"
+#include "market/LogLinearDiscount.hpp"
+#include "market/MonotoneConvexDiscount.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string_view>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using clock_type = std::chrono::high_resolution_clock; 
+
+struct LookupTiming
+{
+    double scalar_ns;   // per call through Discount::operator()
+    double batch_ns;    // per maturity through Discount::evaluate
+};
+
+LookupTiming time_curve(
+    const Discount& curve, 
+    const std::vector<double>& random_T, 
+    const std::vector<double>& sorted_T
+);
+
+void print_timing(std::string_view name, LookupTiming t, LookupTiming flat);
+
+int main()
+{
+    constexpr std::size_t N = 2'000'000;
+
+    std::vector<double> times = {
+        1.0 / 12, 0.25, 0.5, 1, 2, 3, 4, 5, 7, 10, 15, 20, 25, 30
+    };
+    std::vector<double> rates = {
+        0.030, 0.031, 0.033, 0.036, 0.039, 0.040, 0.041, 
+        0.042, 0.043, 0.044, 0.045, 0.045, 0.044, 0.043
+    };
+
+    FlatDiscount flat(0.04);
+    auto log_linear = LogLinearDiscount::from_zero_rates(times, rates);
+    auto monotone = MonotoneConvexDiscount::from_zero_rates(times, rates);
+
+    // Maturities spread over the curve, in random and sorted order
+    RandomEngine rng(1310);
+    std::vector<double> random_T(N);
+    for (double& T : random_T)
+        T = 30.0 * 0.5 * (1.0 + std::erf(rng.normal() / std::sqrt(2.0)));
+    std::vector<double> sorted_T = random_T;
+    std::sort(sorted_T.begin(), sorted_T.end());
+
+    LookupTiming flat_time = time_curve(flat, random_T, sorted_T);
+    LookupTiming ll_time = time_curve(log_linear, random_T, sorted_T);
+    LookupTiming mc_time = time_curve(monotone, random_T, sorted_T);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=========== Discount Lookup Cost ===========\n";
+    std::cout << "Maturities: " << N << ", pillars: " << times.size() << "\n\n";
+    std::cout << std::left << std::setw(20) << "Curve"
+              << std::setw(16) << "Scalar (ns)"
+              << std::setw(16) << "Batch (ns)"
+              << std::setw(16) << "Scalar / Flat"
+              << std::setw(16) << "Batch / Flat"
+              << '\n';
+    print_timing("Flat", flat_time, flat_time);
+    print_timing("Log-linear", ll_time, flat_time);
+    print_timing("Monotone convex", mc_time, flat_time);
+    std::cout << '\n';
+
+    return 0;
+}
+
+LookupTiming time_curve(
+    const Discount& curve, 
+    const std::vector<double>& random_T, 
+    const std::vector<double>& sorted_T
+)
+{
+    const std::size_t n = random_T.size();
+    std::vector<double> df(n);
+    double sink = 0.0;
+
+    auto start = clock_type::now();
+    for (std::size_t i = 0; i < n; ++i)
+        sink += curve(random_T[i]);
+    std::chrono::duration<double> scalar = clock_type::now() - start;
+
+    start = clock_type::now();
+    curve.evaluate(sorted_T.data(), df.data(), n);
+    std::chrono::duration<double> batch = clock_type::now() - start;
+
+    // Keep the results observable
+    if (sink + df[n / 2] < 0.0)
+        std::cout << sink << '\n';
+
+    return {1e9 * scalar.count() / n, 1e9 * batch.count() / n};
+}
+
+void print_timing(std::string_view name, LookupTiming t, LookupTiming flat)
+{
+    std::cout << std::left << std::setw(20) << name
+              << std::setw(16) << t.scalar_ns
+              << std::setw(16) << t.batch_ns
+              << std::setw(16) << t.scalar_ns / flat.scalar_ns
+              << std::setw(16) << t.batch_ns / flat.batch_ns
+              << '\n';
+}
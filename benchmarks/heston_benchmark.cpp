@@ -0,0 +1,50 @@
+#include "models/HestonModel.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+
+using clock_type = std::chrono::high_resolution_clock; 
+
+int main()
+{
+    constexpr std::size_t N = 1'000'000;
+    constexpr std::size_t n_steps = 50;
+
+    HestonModel model(100.0, 0.0, 0.0175, 1.5768, 0.0398, 0.5751, -0.5711);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n========= Heston QE Throughput =========\n";
+    std::cout << "Paths: " << N << ", steps: " << n_steps << "\n\n";
+    std::cout << std::left << std::setw(16) << "Block size"
+              << std::setw(16) << "Time (s)"
+              << std::setw(24) << "M steps x paths / s"
+              << '\n';
+
+    for (std::size_t block : {256, 1024, 4096, 16384, 65536})
+    {
+        HestonPathBlock paths(block);
+        RandomEngine rng(1310);
+        double checksum = 0.0;
+
+        auto start = clock_type::now();
+        for (std::size_t done = 0; done < N; done += block)
+        {
+            model.simulate_block(1.0, n_steps, rng, paths);
+            checksum += paths.log_spot[0];
+        }
+        std::chrono::duration<double> elapsed = clock_type::now() - start;
+
+        std::size_t simulated = (N + block - 1) / block * block;
+        std::cout << std::setw(16) << block
+                  << std::setw(16) << elapsed.count()
+                  << std::setw(24) 
+                  << simulated * n_steps / elapsed.count() / 1e6
+                  << (std::isfinite(checksum) ? "" : " (non-finite state)")
+                  << '\n';
+    }
+    std::cout << '\n';
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include "core/PricingContext.hpp"
+#include "samplers/MCSampler.hpp"
+#include "samplers/ControlSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "options/NoOption.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/RandomEngine.hpp"
+#include "analytics/BlackScholesClosedForm.hpp"
+#include "analytics/CalibrateControl.hpp"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+using clock_type = std::chrono::steady_clock; 
+
+// Counts every heap allocation in the process
+static std::atomic<std::size_t> allocations{0};
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+struct LatencyReport
+{
+    std::vector<double> micros; 
+    std::size_t allocations;
+};
+
+/// Times each request in isolation and counts allocations across all of them.
+/// between_requests runs untimed after each request, standing in for idle time.
+template <class Price, class Idle = void (*)()>
+LatencyReport measure(
+    const std::vector<PricingRequest>& requests, 
+    Price&& price, 
+    Idle between_requests = [] {}
+);
+
+void print_report(const std::string& name, LatencyReport report, std::size_t n_requests);
+
+/// Today's path: objects built per request, calibrate_beta pilot, make_unique samplers.
+PricingQuote price_per_request(const PricingRequest& request, unsigned int seed);
+
+int main()
+{
+    constexpr std::size_t n_paths = 20'000; 
+    constexpr std::size_t n_requests = 5'000; 
+    constexpr std::size_t n_warmup = 100;
+
+    // Intraday-style stream: spot and vol drift, strikes cycle through a strip
+    std::vector<PricingRequest> requests; 
+    for (std::size_t i = 0; i < n_requests + n_warmup; ++i)
+    {
+        double spot = 100.0 + 0.01 * static_cast<double>(i % 200); 
+        double strike = 90.0 + 5.0 * static_cast<double>(i % 5);
+        double vol = 0.2 + 0.0001 * static_cast<double>(i % 50);
+        OptionType type = i % 2 ? OptionType::Call : OptionType::Put;
+        requests.push_back({spot, strike, vol, 0.05, 1.0, type, n_paths});
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n========= Single-Trade Latency =========\n";
+    std::cout << "Requests: " << n_requests << ", paths per request: " << n_paths << "\n\n";
+    std::cout << std::left << std::setw(22) << "Path"
+              << std::setw(12) << "p50 (us)"
+              << std::setw(12) << "p99 (us)"
+              << std::setw(12) << "p999 (us)"
+              << std::setw(12) << "max (us)"
+              << std::setw(12) << "allocs/req" << '\n';
+
+    std::vector<PricingRequest> warmup(requests.begin(), requests.begin() + n_warmup);
+    std::vector<PricingRequest> timed(requests.begin() + n_warmup, requests.end());
+
+    // Idle time between quotes refills the pool, outside the timed call
+    PricingContext context;
+    auto pooled = [&](const PricingRequest& r) { return context.price(r); };
+    auto idle = [&] { context.replenish(); };
+    measure(warmup, pooled, idle);
+    print_report("Context, warm pool", measure(timed, pooled, idle), timed.size());
+
+    // No idle time: every request generates its draws inline
+    PricingContext inline_context(1310, n_paths);
+    auto drawing = [&](const PricingRequest& r) { return inline_context.price(r); };
+    measure(warmup, drawing);
+    print_report("Context, inline draws", measure(timed, drawing), timed.size());
+
+    unsigned int seed = 1310;
+    measure(warmup, [&](const PricingRequest& r) { return price_per_request(r, seed++); });
+    print_report("Per-request objects", 
+        measure(timed, [&](const PricingRequest& r) { return price_per_request(r, seed++); }), 
+        timed.size());
+
+    // Accuracy of both paths on one quote
+    const PricingRequest& r = timed.front();
+    PricingQuote fast = context.price(r); 
+    PricingQuote slow = price_per_request(r, 42);
+    std::cout << "\nSample quote: context " << std::setprecision(4) << fast.price 
+              << " +/- " << fast.standard_error 
+              << ", per-request " << slow.price << " +/- " << slow.standard_error 
+              << ", analytic " 
+              << black_scholes_price(r.spot, r.strike, r.rate, r.volatility, r.maturity, r.type) 
+              << '\n';
+
+    return 0;
+}
+
+template <class Price, class Idle>
+LatencyReport measure(
+    const std::vector<PricingRequest>& requests, 
+    Price&& price, 
+    Idle between_requests
+)
+{
+    LatencyReport report; 
+    report.micros.reserve(requests.size());
+    std::size_t before = allocations.load(); 
+    volatile double sink = 0.0;
+    for (const PricingRequest& request : requests)
+    {
+        auto start = clock_type::now(); 
+        PricingQuote quote = price(request);
+        auto end = clock_type::now(); 
+        sink = sink + quote.price;
+        report.micros.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        between_requests();
+    }
+    report.allocations = allocations.load() - before;
+    return report;
+}
+
+void print_report(const std::string& name, LatencyReport report, std::size_t n_requests)
+{
+    std::vector<double>& v = report.micros;
+    std::sort(v.begin(), v.end());
+    auto pct = [&](double q) { return v[static_cast<std::size_t>(q * (v.size() - 1))]; };
+    std::cout << std::setw(22) << name
+              << std::setw(12) << pct(0.50)
+              << std::setw(12) << pct(0.99)
+              << std::setw(12) << pct(0.999)
+              << std::setw(12) << v.back()
+              << std::setw(12) << static_cast<double>(report.allocations) / n_requests << '\n';
+}
+
+PricingQuote price_per_request(const PricingRequest& request, unsigned int seed)
+{
+    double T = request.maturity;
+    BlackScholesModel model(request.spot, request.rate, request.volatility); 
+    EuropeanOption option(request.strike, T, request.type); 
+    NoOption control(T); 
+    RandomEngine rng(seed);
+
+    MCSampler target_calib(model, option); 
+    MCSampler control_calib(model, control); 
+    double beta = calibrate_beta(target_calib, control_calib, rng, 10'000, 1000, 0.01);
+
+    double forward = request.spot * std::exp(request.rate * T);
+    ControlSampler sampler(
+        std::make_unique<MCSampler>(model, option), 
+        std::make_unique<MCSampler>(model, control), 
+        forward, 
+        beta
+    );
+    MonteCarloEngine engine(sampler); 
+    OnlineStatistics stats = engine.run(request.n_paths, rng);
+    double discount = std::exp(-request.rate * T);
+    return {discount * stats.mean(), discount * stats.standard_error(), beta};
+}
@@ -0,0 +1,75 @@
+#include "models/BlackScholesModel.hpp"
+#include "options/BermudanOption.hpp"
+#include "market/FlatDiscount.hpp"
+#include "core/LongstaffSchwartzPricer.hpp"
+#include "analytics/BlackScholesClosedForm.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <sys/resource.h>
+
+using clock_type = std::chrono::high_resolution_clock; 
+
+/// Peak resident set size of the process so far, in MB.
+double peak_rss_mb();
+
+int main()
+{
+    // Longstaff & Schwartz (2001) Table 1 case: reported value about 4.47
+    double S = 36.0;
+    double r = 0.06;
+    double v = 0.2;
+    double T = 1.0;
+    double K = 40.0;
+    std::size_t n_dates = 50;
+
+    FlatDiscount discount(r);
+    BlackScholesModel model(S, r, v);
+    BermudanOption put = BermudanOption::american(K, T, n_dates, OptionType::Put);
+    LongstaffSchwartzPricer pricer(model, put, discount);
+
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << "\n=============== Longstaff-Schwartz American Put ===============\n";
+    std::cout << "S=36, K=40, T=1, r=6%, sigma=20%, exercise dates: " << n_dates << '\n';
+    std::cout << "European: " << black_scholes_price(S, K, r, v, T, OptionType::Put) 
+              << "\n\n";
+    std::cout << std::left << std::setw(12) << "Paths"
+              << std::setw(10) << "Price"
+              << std::setw(10) << "Std Err"
+              << std::setw(12) << "In-sample"
+              << std::setw(10) << "Time (s)"
+              << std::setw(14) << "Working (MB)"
+              << std::setw(14) << "Matrix (MB)"
+              << std::setw(14) << "Peak RSS (MB)"
+              << '\n';
+
+    for (std::size_t n : {50'000, 200'000, 1'000'000, 4'000'000})
+    {
+        auto start = clock_type::now();
+        LsmResult result = pricer.price(n, n);
+        std::chrono::duration<double> elapsed = clock_type::now() - start;
+
+        // What storing every path at every date would have taken
+        double matrix_mb = n * n_dates * sizeof(double) / 1e6;
+
+        std::cout << std::setw(12) << n
+                  << std::setw(10) << result.price
+                  << std::setw(10) << result.standard_error
+                  << std::setw(12) << result.in_sample_price
+                  << std::setw(10) << elapsed.count()
+                  << std::setw(14) << result.working_bytes / 1e6
+                  << std::setw(14) << matrix_mb
+                  << std::setw(14) << peak_rss_mb()
+                  << '\n';
+    }
+    std::cout << '\n';
+
+    return 0;
+}
+
+double peak_rss_mb()
+{
+    rusage usage; 
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;    // kilobytes on Linux
+}
@@ -0,0 +1,90 @@
+#include "samplers/MCSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/NormalStore.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string_view>
+#include <chrono>
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+using clock_type = std::chrono::high_resolution_clock; 
+
+void print_rate(std::string_view name, std::size_t n, double seconds);
+
+int main()
+{
+    constexpr std::size_t N = 10'000'000;
+    constexpr std::size_t block = MonteCarloEngine::block_size;
+    const char* path = "normal_store_benchmark.bin";
+
+    write_normal_store(path, N, 1310);
+
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << "\n====== Normal Store Throughput ======\n";
+    std::cout << "Draws: " << N << "\n\n";
+
+    // Raw draw throughput -----------------------------------------------------
+    std::vector<double> scratch(block);
+    double checksum = 0.0;
+
+    RandomEngine rng(1310);
+    auto start = clock_type::now();
+    for (std::size_t done = 0; done < N; done += block)
+    {
+        std::size_t n = std::min(block, N - done);
+        const double* Z = rng.next_block(scratch.data(), n);
+        for (std::size_t i = 0; i < n; ++i) checksum += Z[i];
+    }
+    std::chrono::duration<double> gen_time = clock_type::now() - start;
+
+    start = clock_type::now();
+    MappedNormalStore store(path, false);
+    for (std::size_t done = 0; done < N; done += block)
+    {
+        std::size_t n = std::min(block, N - done);
+        const double* Z = store.next_block(scratch.data(), n);
+        for (std::size_t i = 0; i < n; ++i) checksum -= Z[i];
+    }
+    std::chrono::duration<double> map_time = clock_type::now() - start;
+
+    print_rate("Generate (MT19937)", N, gen_time.count());
+    print_rate("Mapped store", N, map_time.count());
+
+    // End-to-end pricing -------------------------------------------------------
+    BlackScholesModel model(100.0, 0.05, 0.2);
+    EuropeanOption option(100.0, 1.0, OptionType::Call);
+    MCSampler sampler(model, option);
+    MonteCarloEngine engine(sampler);
+
+    rng.seed(1310);
+    start = clock_type::now();
+    OnlineStatistics gen_result = engine.run(N, rng);
+    gen_time = clock_type::now() - start;
+
+    store.seek(0);
+    start = clock_type::now();
+    OnlineStatistics map_result = engine.run(N, store);
+    map_time = clock_type::now() - start;
+
+    std::cout << '\n';
+    print_rate("MC run (generate)", N, gen_time.count());
+    print_rate("MC run (mapped)", N, map_time.count());
+    std::cout << "\nMean payoff (generate): " << gen_result.mean() << '\n';
+    std::cout << "Mean payoff (mapped):   " << map_result.mean() << '\n';
+    std::cout << "Draw checksum residual: " << checksum << "\n\n";
+
+    std::remove(path);
+    return 0;
+}
+
+void print_rate(std::string_view name, std::size_t n, double seconds)
+{
+    std::cout << std::left << std::setw(25) << name 
+              << std::setw(12) << seconds << " s   "
+              << n / seconds / 1e6 << " M draws/s\n";
+}
@@ -0,0 +1,95 @@
+#include "samplers/FusedControlSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/OnlineCovariance.hpp"
+#include "core/PathDump.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <chrono>
+#include <cstdio>
+
+using clock_type = std::chrono::high_resolution_clock; 
+
+int main()
+{
+    constexpr std::size_t N = 10'000'000;
+    constexpr std::size_t N_text = 1'000'000;
+    const char* file = "path_dump_benchmark.bin";
+    const char* text_file = "path_dump_benchmark.txt";
+
+    BlackScholesModel model(100.0, 0.05, 0.2); 
+    EuropeanOption call(105.0, 1.0, OptionType::Call);
+    EuropeanOption control(100.0, 1.0, OptionType::Call);
+    FusedControlSampler sampler(model, call, control, 10.45, 0.9);
+
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << "\n========= Per-Path Column Dump =========\n";
+    std::cout << "Paths: " << N << "\n\n";
+
+    double plain_time, dump_time, close_time; 
+    {
+        MonteCarloEngine engine(sampler); 
+        RandomEngine rng(1310);
+        auto start = clock_type::now();
+        engine.run(N, rng);
+        plain_time = std::chrono::duration<double>(clock_type::now() - start).count();
+    }
+    {
+        MonteCarloEngine engine(sampler); 
+        PathDumpWriter writer(file, sampler);
+        engine.attach(writer);
+        RandomEngine rng(1310);
+        auto start = clock_type::now();
+        engine.run(N, rng);
+        dump_time = std::chrono::duration<double>(clock_type::now() - start).count();
+        writer.close();
+        close_time = std::chrono::duration<double>(clock_type::now() - start).count();
+    }
+
+    // Text baseline on a tenth of the paths
+    double text_time;
+    {
+        RandomEngine rng(1310);
+        std::ofstream out(text_file);
+        PathRecord record;
+        auto start = clock_type::now();
+        for (std::size_t i = 0; i < N_text; ++i)
+        {
+            double Z = rng.normal();
+            sampler.record(Z, record);
+            out << Z << ',' << record.terminal << ',' 
+                << record.payoff << ',' << record.control << '\n';
+        }
+        out.close();
+        text_time = std::chrono::duration<double>(clock_type::now() - start).count();
+    }
+
+    double megabytes = 4.0 * N * sizeof(double) / (1024.0 * 1024.0);
+    std::cout << "Engine run, no sink:         " << plain_time << " s\n";
+    std::cout << "Engine run, dump attached:   " << dump_time << " s\n";
+    std::cout << "Run + drain + close:         " << close_time << " s (" 
+              << megabytes / close_time << " MiB/s)\n";
+    std::cout << "Text rows (extrapolated):    " << text_time * N / N_text << " s\n\n";
+
+    // Offline pass over the mapped columns: the beta a calibrate_beta pilot sees
+    auto start = clock_type::now();
+    PathDumpReader reader(file);
+    OnlineCovariance cov;
+    for (std::size_t c = 0; c < reader.n_chunks(); ++c)
+    {
+        const double* X = reader.column(c, PathColumn::Payoff);
+        const double* Y = reader.column(c, PathColumn::Control);
+        for (std::size_t i = 0; i < reader.chunk_size(c); ++i)
+            cov.add(X[i], Y[i]);
+    }
+    double read_time = std::chrono::duration<double>(clock_type::now() - start).count();
+    std::cout << "Mapped read of " << reader.size() << " paths: " << read_time << " s\n";
+    std::cout << "Offline beta: " << cov.covariance() / cov.variance_y() << '\n';
+
+    std::remove(file);
+    std::remove(text_file);
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include "samplers/MCSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "options/DigitalOption.hpp"
+#include "options/ScriptedOption.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/ScriptedEngine.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+
+using clock_type = std::chrono::high_resolution_clock; 
+
+/// Seconds to evaluate option.payoff over every ST, one virtual call each.
+double time_subclass(const Option& option, const std::vector<double>& ST, double& sum);
+
+/// Seconds to evaluate the script over every ST, one block at a time.
+double time_script(const ScriptedOption& option, const std::vector<double>& ST, double& sum);
+
+int main()
+{
+    constexpr std::size_t N = 4'000'000; 
+    constexpr std::size_t repeats = 10; 
+
+    BlackScholesModel model(100.0, 0.05, 0.2); 
+    EuropeanOption call(100.0, 1.0, OptionType::Call);
+    DigitalOption digital(105.0, 1.0, 10.0, OptionType::Call);
+    ScriptedOption scripted_call("max(ST - 100, 0)", 1.0);
+    ScriptedOption scripted_digital("10 * (ST > 105)", 1.0);
+    ScriptedOption scripted_spread("min(max(ST - 95, 0), 10) - 0.5 * (ST < 90)", 1.0);
+
+    RandomEngine rng(1310); 
+    std::vector<double> ST(N);
+    for (double& s : ST)
+        s = model.simulate(1.0, rng.normal());
+
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << "\n========= Payoff Script Interpreter =========\n";
+    std::cout << "Payoff evaluations: " << N << " x " << repeats << "\n\n";
+    std::cout << std::left << std::setw(26) << "Payoff"
+              << std::setw(14) << "Subclass ns"
+              << std::setw(14) << "Script ns"
+              << std::setw(10) << "Ratio"
+              << std::setw(8) << "Ops" << '\n';
+
+    auto row = [&](const std::string& name, const Option* option, const ScriptedOption& script)
+    {
+        double a = 0.0, b = 0.0, t_sub = 0.0, t_script = 0.0;
+        for (std::size_t r = 0; r < repeats; ++r)
+        {
+            if (option)
+                t_sub += time_subclass(*option, ST, a);
+            t_script += time_script(script, ST, b);
+        }
+        double scale = 1e9 / (N * repeats);
+        std::cout << std::setw(26) << name; 
+        if (option)
+            std::cout << std::setw(14) << t_sub * scale;
+        else 
+            std::cout << std::setw(14) << "-";
+        std::cout << std::setw(14) << t_script * scale;
+        if (option)
+            std::cout << std::setw(10) << t_script / t_sub;
+        else 
+            std::cout << std::setw(10) << "-";
+        std::cout << std::setw(8) << script.script().code().size() << '\n';
+        if (option && a != b)
+            std::cout << "  payoff sums differ\n";
+    };
+    row("max(ST - 100, 0)", &call, scripted_call);
+    row("10 * (ST > 105)", &digital, scripted_digital);
+    row("capped spread (script)", nullptr, scripted_spread);
+
+    // End to end: simulation plus payoff through each engine
+    MCSampler sampler(model, call); 
+    MonteCarloEngine engine(sampler); 
+    RandomEngine engine_rng(1310); 
+    auto start = clock_type::now();
+    OnlineStatistics expected = engine.run(N, engine_rng);
+    double engine_time = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    ScriptedEngine scripted_engine(model, scripted_call); 
+    RandomEngine scripted_rng(1310); 
+    start = clock_type::now();
+    OnlineStatistics actual = scripted_engine.run(N, scripted_rng);
+    double scripted_time = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    std::cout << "\nEnd-to-end call pricing (" << N << " paths)\n";
+    std::cout << "  MonteCarloEngine + EuropeanOption: " << engine_time 
+              << " s, mean " << expected.mean() << '\n';
+    std::cout << "  ScriptedEngine + script:           " << scripted_time 
+              << " s, mean " << actual.mean() << '\n';
+
+    return 0;
+}
+
+double time_subclass(const Option& option, const std::vector<double>& ST, double& sum)
+{
+    auto start = clock_type::now();
+    for (double s : ST)
+        sum += option.payoff(s);
+    return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+double time_script(const ScriptedOption& option, const std::vector<double>& ST, double& sum)
+{
+    constexpr std::size_t block = ScriptedEngine::block_size;
+    std::vector<double> out(block); 
+    std::vector<double> scratch(option.script().scratch_size(block));
+
+    auto start = clock_type::now();
+    for (std::size_t done = 0; done < ST.size(); done += block)
+    {
+        std::size_t n = std::min(block, ST.size() - done);
+        const double* columns[] = {ST.data() + done};
+        option.payoff_block(columns, n, out.data(), scratch.data());
+        for (std::size_t i = 0; i < n; ++i)
+            sum += out[i];
+    }
+    return std::chrono::duration<double>(clock_type::now() - start).count();
+}
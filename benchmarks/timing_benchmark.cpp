@@ -1,6 +1,8 @@
 #include "samplers/MCSampler.hpp"
 #include "samplers/AntitheticSampler.hpp"
 #include "samplers/ControlSampler.hpp"
+#include "samplers/FusedControlSampler.hpp"
+#include "samplers/FusedAntitheticControlSampler.hpp"
 #include "models/BlackScholesModel.hpp"
 #include "options/EuropeanOption.hpp"
 #include "options/NoOption.hpp"
@@ -105,6 +107,24 @@ int main()
 
     TimedResult cv_time = time_engine(cv_engine, cv_rng, N); 
 
+// FusedControlSampler --------------------------------------------------------
+    // same estimator as ControlSampler, one simulation per path
+    FusedControlSampler fused_sampler(model, option, control, control_mean, beta);
+    MonteCarloEngine fused_engine(fused_sampler); 
+    RandomEngine fused_rng(1310); 
+
+    TimedResult fused_time = time_engine(fused_engine, fused_rng, N); 
+
+// FusedAntitheticControlSampler ----------------------------------------------
+    FusedAntitheticControlSampler anti_cv_sampler(
+        model, option, control, control_mean, beta
+    );
+    MonteCarloEngine anti_cv_engine(anti_cv_sampler); 
+    RandomEngine anti_cv_rng(1310); 
+
+    // uses N / 2 paths 
+    TimedResult anti_cv_time = time_engine(anti_cv_engine, anti_cv_rng, N / 2); 
+
 // Results --------------------------------------------------------------------
     std::cout << std::fixed << std::setprecision(4);
     std::cout << '\n';
@@ -112,6 +132,8 @@ int main()
     print_time("MC", mc_time, mc_time);
     print_time("Antithetic", anti_time, mc_time);
     print_time("Control", cv_time, mc_time);
+    print_time("Control (fused)", fused_time, mc_time);
+    print_time("Anti+Control", anti_cv_time, mc_time);
     std::cout << '\n';
 
     return 0;
@@ -1,15 +1,18 @@
 #pragma once 
 #include "samplers/PathSampler.hpp"
-#include "core/RandomEngine.hpp"
+#include "core/NormalSource.hpp"
 #include <cstddef> 
 
 /// Estimates the control variate coefficient (beta) within a given error target, 
-/// using the sample covariance and variance. 
+/// using the sample covariance and variance. If samples_used is given, it 
+/// receives the number of draws taken, which is below max_samples when the 
+/// target is met early.
 double calibrate_beta(
     PathSampler& target, 
     PathSampler& control, 
-    RandomEngine& rng,
+    NormalSource& rng,
     std::size_t max_samples, 
     std::size_t min_samples = 1000,
-    double error_target = 0.05
+    double error_target = 0.05,
+    std::size_t* samples_used = nullptr
 );
\ No newline at end of file
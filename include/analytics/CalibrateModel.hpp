@@ -0,0 +1,73 @@
+#pragma once
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "market/Discount.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// A market price to fit, with its weight in the least-squares objective.
+struct CalibrationQuote
+{
+    EuropeanOption option; 
+    double price; 
+    double weight = 1.0;
+};
+
+/// Outcome of a volatility fit.
+struct VolCalibration
+{
+    double volatility; 
+    double rmse;                // weighted RMS pricing error at the fit
+    std::size_t iterations; 
+    bool converged;
+};
+
+/// Fits the Black-Scholes volatility to a strip of European quotes by 
+/// Gauss-Newton on common random numbers. Draws are generated once and kept 
+/// resident, so the objective is a smooth deterministic function of the 
+/// volatility. Each evaluation simulates ST once per path and maturity and 
+/// prices every strike on it, with pathwise vegas from the same draws.
+class FrozenDrawCalibrator
+{
+public: 
+    FrozenDrawCalibrator(
+        const BlackScholesModel& model, 
+        const Discount& discount, 
+        std::vector<CalibrationQuote> quotes, 
+        std::size_t n_paths, 
+        std::uint64_t seed = 1310
+    );
+
+    /// MC prices and d(price)/d(volatility) for each quote, on the frozen draws.
+    void evaluate(double volatility, double* prices, double* vegas);
+
+    /// Starts from the model volatility and iterates until the step is 
+    /// below tolerance.
+    VolCalibration calibrate(
+        double tolerance = 1e-8, 
+        std::size_t max_iterations = 50
+    );
+
+    std::size_t n_paths() const { return Z_.size(); }
+    std::size_t n_quotes() const { return quotes_.size(); }
+
+private: 
+    static constexpr std::size_t block_size = 1024;
+
+    struct Expiry
+    {
+        double maturity; 
+        double discount; 
+        std::vector<std::size_t> quotes;
+    };
+
+    double spot_; 
+    double rate_; 
+    double initial_vol_;
+    std::vector<CalibrationQuote> quotes_; 
+    std::vector<Expiry> expiries_; 
+    std::vector<double> Z_; 
+    std::vector<double> ST_; 
+    std::vector<double> dST_;
+};
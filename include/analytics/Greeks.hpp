@@ -1 +1,42 @@
-// WIP
\ No newline at end of file
+#pragma once
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "core/NormalSource.hpp"
+#include <cstddef>
+
+/// Price and first-order sensitivities to every Black-Scholes input.
+struct Greeks
+{
+    double price; 
+    double delta;   // d/d spot
+    double vega;    // d/d volatility
+    double rho;     // d/d rate, through drift and discounting
+    double theta;   // -d/d maturity
+};
+
+/// Monte Carlo Greeks with their standard errors.
+struct GreeksEstimate
+{
+    Greeks value; 
+    Greeks standard_error;
+};
+
+/// Greeks by reverse-mode AAD: each path tapes the discounted payoff on 
+/// Active inputs and a single adjoint sweep yields every sensitivity.
+/// Discounting uses the model rate.
+GreeksEstimate aad_greeks(
+    const BlackScholesModel& model, 
+    const EuropeanOption& option, 
+    std::size_t n_paths, 
+    NormalSource& rng
+);
+
+/// Greeks by central bump-and-revalue on common random numbers: nine 
+/// repricings of n_paths, each input bumped by relative_bump of its value.
+Greeks bump_greeks(
+    const BlackScholesModel& model, 
+    const EuropeanOption& option, 
+    std::size_t n_paths, 
+    unsigned int seed, 
+    double relative_bump = 1e-4
+);
@@ -0,0 +1,17 @@
+#pragma once
+#include "options/OptionType.hpp"
+
+/// Gives the semi-analytic Heston price of a European option, integrating the 
+/// characteristic function in the "little trap" form of Albrecher et al. (2007).
+double heston_price(
+    double spot, 
+    double strike, 
+    double rate, 
+    double v0, 
+    double kappa, 
+    double theta, 
+    double xi, 
+    double rho, 
+    double maturity, 
+    OptionType type
+);
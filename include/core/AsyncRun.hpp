@@ -0,0 +1,72 @@
+#pragma once
+#include "samplers/PathSampler.hpp"
+#include "core/OnlineStatistics.hpp"
+#include "core/NormalSource.hpp"
+#include "core/EngineObserver.hpp"
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/// Intermediate result of an asynchronous run (undiscounted).
+struct PricingSnapshot
+{
+    std::size_t paths_done = 0; 
+    double mean = 0.0; 
+    double standard_error = 0.0;
+    bool finished = false;
+};
+
+/// Handle to a simulation running on a background thread. The worker 
+/// publishes a snapshot at block boundaries through a sequence lock, so it 
+/// never waits on readers and adds no work inside the per-path loop.
+/// The sampler and source must outlive the run.
+class AsyncRun
+{
+public: 
+    /// observers are notified of every block from the worker thread.
+    AsyncRun(
+        const PathSampler& sampler, 
+        std::vector<EngineObserver*> observers, 
+        std::size_t n_paths, 
+        NormalSource& rng, 
+        std::size_t publish_every
+    );
+    ~AsyncRun();
+
+    AsyncRun(AsyncRun&&) noexcept = default;
+    AsyncRun& operator=(AsyncRun&&) = delete;
+
+    /// Latest published snapshot; never blocks the worker.
+    PricingSnapshot snapshot() const;
+
+    /// Asks the worker to stop at the next block boundary.
+    void cancel();
+    bool cancelled() const;
+    bool done() const;
+
+    /// Waits for the worker and returns its statistics, 
+    /// covering fewer paths than requested if the run was cancelled. 
+    /// Rethrows any exception the sampler or source threw on the worker.
+    OnlineStatistics get();
+
+private: 
+    struct State 
+    {
+        std::atomic<std::size_t> sequence{0};
+        std::atomic<std::size_t> paths_done{0};
+        std::atomic<double> mean{0.0};
+        std::atomic<double> standard_error{0.0};
+        std::atomic<bool> finished{false};
+        std::atomic<bool> cancel{false};
+        OnlineStatistics result;
+        std::exception_ptr error;
+
+        void publish(const OnlineStatistics& stats, bool last);
+    };
+
+    std::unique_ptr<State> state_; 
+    std::thread worker_;
+};
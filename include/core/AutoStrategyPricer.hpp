@@ -0,0 +1,80 @@
+#pragma once
+#include "models/Model.hpp"
+#include "options/Option.hpp"
+#include "samplers/PathSampler.hpp"
+#include "core/OnlineStatistics.hpp"
+#include "core/NormalSource.hpp"
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/// Variance reduction strategies the auto pricer chooses between.
+enum class Strategy { Plain, Antithetic, Control, AntitheticControl };
+
+std::string_view strategy_name(Strategy strategy);
+
+/// Pilot measurements for one strategy. A sample may simulate several 
+/// paths (two for antithetic strategies).
+struct StrategyPilot
+{
+    Strategy strategy; 
+    double variance;            // per-sample estimator variance
+    double seconds_per_sample; 
+    std::size_t paths_per_sample;
+
+    /// Inverse of the variance achieved per second of compute.
+    double efficiency() const { return 1.0 / (variance * seconds_per_sample); }
+};
+
+/// Outcome of an automatic run: the main run's undiscounted statistics, 
+/// excluding pilot samples.
+struct AutoPricingResult
+{
+    Strategy strategy; 
+    std::vector<StrategyPilot> pilots; 
+    double beta;                    // calibrated control coefficient, 0 without a control
+    double expected_speedup;        // chosen efficiency over plain MC, 1 if plain MC has no variance
+    std::size_t pilot_paths;        // paths spent on calibration and pilots
+    OnlineStatistics stats;
+};
+
+/// Picks a variance reduction strategy per trade from short pilots. Beta is 
+/// calibrated first, then each applicable strategy runs pilot_paths paths 
+/// to measure variance and cost per sample, and the remaining budget goes 
+/// to the strategy with the highest 1 / (variance x cost).
+class AutoStrategyPricer
+{
+public: 
+    AutoStrategyPricer(
+        const Model& model, 
+        const Option& option, 
+        std::size_t pilot_paths = 20'000
+    );
+
+    /// Also considers control variates on control, whose expected payoff 
+    /// is control_mean.
+    AutoStrategyPricer(
+        const Model& model, 
+        const Option& option, 
+        const Option& control, 
+        double control_mean, 
+        std::size_t pilot_paths = 20'000
+    );
+
+    /// Spends n_paths simulated paths in total, pilots included.
+    AutoPricingResult run(std::size_t n_paths, NormalSource& rng) const;
+
+    /// Spends roughly the given wall-clock time in total, pilots included.
+    AutoPricingResult run_for(double seconds, NormalSource& rng) const;
+
+private: 
+    std::unique_ptr<PathSampler> make_sampler(Strategy strategy, double beta) const;
+    AutoPricingResult select(NormalSource& rng) const;
+
+    const Model& model_; 
+    const Option& option_; 
+    const Option* control_ = nullptr; 
+    double control_mean_ = 0.0;
+    std::size_t pilot_paths_;
+};
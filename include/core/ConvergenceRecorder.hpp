@@ -0,0 +1,77 @@
+#pragma once
+#include "core/EngineObserver.hpp"
+#include "core/OnlineStatistics.hpp"
+#include "samplers/PathSampler.hpp"
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// Path counts from first to last with steps_per_decade geometric steps per 
+/// factor of ten, rounded to integers; both ends are included.
+std::vector<std::size_t> geometric_checkpoints(
+    std::size_t first, 
+    std::size_t last, 
+    std::size_t steps_per_decade = 3
+);
+
+/// Engine observer snapshotting the running statistics whenever the run 
+/// reaches a checkpoint, so one run yields the whole convergence curve. 
+/// Snapshots equal what a fresh run of that many samples would return.
+class ConvergenceRecorder : public EngineObserver
+{
+public: 
+    /// checkpoints are sample counts in strictly increasing order.
+    explicit ConvergenceRecorder(std::vector<std::size_t> checkpoints);
+
+    void observe(const PathBlock& block) override;
+
+    const std::vector<std::size_t>& checkpoints() const { return checkpoints_; }
+
+    /// One entry per checkpoint reached so far.
+    const std::vector<OnlineStatistics>& snapshots() const { return snapshots_; }
+
+private: 
+    std::vector<std::size_t> checkpoints_; 
+    std::vector<OnlineStatistics> snapshots_; 
+    OnlineStatistics stats_;
+};
+
+/// Runs sampler once per seed, in parallel, up to the last checkpoint and 
+/// returns each run's snapshots, e.g. for confidence bands.
+std::vector<std::vector<OnlineStatistics>> record_convergence(
+    const PathSampler& sampler, 
+    const std::vector<std::size_t>& checkpoints, 
+    const std::vector<unsigned int>& seeds
+);
+
+/// Standard errors by path count, written as CSV.
+class ConvergenceTable
+{
+public: 
+    explicit ConvergenceTable(std::vector<std::size_t> paths);
+
+    /// Standard errors of one run's snapshots, times scale (e.g. a discount factor).
+    void add_column(
+        const std::string& name, 
+        const std::vector<OnlineStatistics>& snapshots, 
+        double scale = 1.0
+    );
+
+    /// Mean, min and max standard error across runs as name, name_lo and name_hi.
+    void add_band(
+        const std::string& name, 
+        const std::vector<std::vector<OnlineStatistics>>& runs, 
+        double scale = 1.0
+    );
+
+    void add_values(const std::string& name, std::vector<double> values);
+
+    /// Writes a header row then one row per path count; false if the 
+    /// file cannot be opened.
+    bool write_csv(const std::string& path) const;
+
+private: 
+    std::vector<std::size_t> paths_; 
+    std::vector<std::pair<std::string, std::vector<double>>> columns_;
+};
@@ -0,0 +1,26 @@
+#pragma once
+#include "samplers/PathSampler.hpp"
+#include <cstddef>
+
+/// A block of consecutive paths as sampled by a MonteCarloEngine run.
+struct PathBlock
+{
+    std::size_t first_path;     // index of the block's first path in the run
+    std::size_t size; 
+    const double* Z;            // draws fed to the sampler
+    const double* estimates;    // sampler output per path
+    const PathRecord* records;  // per path if an observer wants records, else null
+};
+
+/// Receives each block of per-path estimates alongside the engine's own 
+/// OnlineStatistics, e.g. to build distributions or record convergence.
+class EngineObserver
+{
+public: 
+    virtual ~EngineObserver() = default; 
+    virtual void observe(const PathBlock& block) = 0;
+
+    /// True to have the engine sample through PathSampler::record and pass 
+    /// the records along with the estimates.
+    virtual bool wants_records() const { return false; }
+};
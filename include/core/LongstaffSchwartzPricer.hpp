@@ -0,0 +1,49 @@
+#pragma once
+#include "models/Model.hpp"
+#include "options/BermudanOption.hpp"
+#include "market/Discount.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// Result of a Longstaff-Schwartz valuation.
+struct LsmResult
+{
+    double price;                   // forward pass on independent draws
+    double standard_error; 
+    double in_sample_price;         // backward pass, biased high
+    std::vector<std::array<double, 3>> coefficients;    // per exercise date
+    std::size_t working_bytes;      // largest buffers held at once
+};
+
+/// Least-squares Monte Carlo (Longstaff & Schwartz, 2001) for Bermudan options, 
+/// regressing on 1, S/K and (S/K)^2 over in-the-money paths.
+///
+/// The backward induction never stores the paths x dates matrix. Paths are 
+/// regenerated date by date with a reverse Brownian bridge, driven by 
+/// StreamRandomEngine substreams that seek to each date, so only the current 
+/// W(t), S(t) and cash flow of each path are held. The regression normal 
+/// equations are accumulated while streaming over paths. The model must be 
+/// driven by W(t) = sqrt(t) Z through simulate(t, Z), as BlackScholesModel is.
+class LongstaffSchwartzPricer
+{
+public: 
+    LongstaffSchwartzPricer(
+        const Model& model, 
+        const BermudanOption& option, 
+        const Discount& discount
+    );
+
+    LsmResult price(
+        std::size_t n_regression_paths, 
+        std::size_t n_pricing_paths, 
+        std::uint64_t regression_seed = 1310, 
+        std::uint64_t pricing_seed = 429
+    ) const;
+
+private: 
+    const Model& model_; 
+    const BermudanOption& option_;
+    const Discount& discount_;
+};
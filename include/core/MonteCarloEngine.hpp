@@ -1,17 +1,84 @@
 #pragma once
 #include "samplers/PathSampler.hpp"
 #include "core/OnlineStatistics.hpp"
-#include "core/RandomEngine.hpp"
+#include "core/NormalSource.hpp"
+#include "core/EngineObserver.hpp"
+#include "core/AsyncRun.hpp"
 #include <cstddef>
+#include <vector>
+
+/// Result of a moment-matched run. Draws within a block are rescaled 
+/// together and no longer independent, so the error comes from the spread 
+/// of the block means rather than from the paths.
+struct MomentMatchedResult
+{
+    double mean;                // block means weighted by block size
+    double standard_error; 
+    std::size_t n_paths; 
+    std::size_t n_blocks;
+};
 
 /// An interface to run MC simulation with a given sampler.
 class MonteCarloEngine
 {
 public:
+    /// Number of draws requested from the source at a time.
+    static constexpr std::size_t block_size = 4096;
+
     explicit MonteCarloEngine(const PathSampler& sampler); 
 
-    OnlineStatistics run(std::size_t n_paths, RandomEngine& rng) const;
+    /// Registers an observer notified of every block sampled by run(), 
+    /// run_moment_matched() (with the matched draws) and run_async() (from 
+    /// the worker thread). The observer must outlive the engine and any 
+    /// run started from it, or be detached first.
+    void attach(EngineObserver& observer);
+    void detach(EngineObserver& observer);
+    const std::vector<EngineObserver*>& observers() const { return observers_; }
+
+    OnlineStatistics run(std::size_t n_paths, NormalSource& rng) const;
+
+    /// Splits the run into n_blocks near-equal blocks and rescales each 
+    /// block's draws to sample mean 0 and variance 1 before sampling. Blocks 
+    /// differ in size by at most one path and are weighted by their size.
+    MomentMatchedResult run_moment_matched(
+        std::size_t n_paths, 
+        NormalSource& rng, 
+        std::size_t n_blocks = 32
+    ) const;
+
+    /// Starts the run on a background thread, publishing a snapshot 
+    /// roughly every publish_every paths (rounded up to whole blocks).
+    AsyncRun run_async(
+        std::size_t n_paths, 
+        NormalSource& rng, 
+        std::size_t publish_every = 16 * block_size
+    ) const;
+
+    /// Adds the sampler estimates for the n draws in Z to stats.
+    void accumulate(const double* Z, std::size_t n, OnlineStatistics& stats) const;
+
+    /// Per-run buffers for sample_block, empty when no observer needs them.
+    struct BlockScratch 
+    {
+        std::vector<double> estimates; 
+        std::vector<PathRecord> records;
+    };
+
+    /// Buffers for blocks of up to n paths with the current observers.
+    BlockScratch block_scratch(std::size_t n) const;
+
+    /// Like accumulate, then passes the block of paths starting at 
+    /// first_path to every observer, sampling through PathSampler::record 
+    /// when an observer wants the records.
+    void sample_block(
+        const double* Z, 
+        std::size_t first_path, 
+        std::size_t n, 
+        OnlineStatistics& stats, 
+        BlockScratch& scratch
+    ) const;
 
 private: 
     const PathSampler& sampler_; 
-};
\ No newline at end of file
+    std::vector<EngineObserver*> observers_;
+};
@@ -0,0 +1,27 @@
+#pragma once
+#include "models/MultiAssetBlackScholesModel.hpp"
+#include "options/MultiAssetOption.hpp"
+#include "core/OnlineStatistics.hpp"
+#include "core/NormalSource.hpp"
+#include <cstddef>
+
+/// Runs MC simulation of a multi-asset option, correlating and evolving 
+/// a block of paths at a time.
+class MultiAssetEngine
+{
+public: 
+    /// Paths simulated per block.
+    static constexpr std::size_t block_size = 256;
+
+    /// Throws if the option reads more assets than the model simulates.
+    MultiAssetEngine(
+        const MultiAssetBlackScholesModel& model, 
+        const MultiAssetOption& option
+    );
+
+    OnlineStatistics run(std::size_t n_paths, NormalSource& rng) const;
+
+private: 
+    const MultiAssetBlackScholesModel& model_; 
+    const MultiAssetOption& option_;
+};
@@ -0,0 +1,18 @@
+#pragma once
+#include <cstddef>
+
+/// Abstract interface for a stream of standard Normal draws.
+class NormalSource
+{
+public: 
+    virtual ~NormalSource() = default; 
+
+    /// Returns the next draw in the stream.
+    virtual double normal() = 0; 
+
+    /// Writes the next n draws to out.
+    virtual void fill(double* out, std::size_t n);
+
+    /// Returns the next n draws, either written to scratch or served in place.
+    virtual const double* next_block(double* scratch, std::size_t n);
+};
@@ -0,0 +1,66 @@
+#pragma once
+#include "core/NormalSource.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// On-disk layout of a normal store: a fixed header followed by raw doubles.
+struct NormalStoreHeader
+{
+    static constexpr std::uint32_t current_version = 1;
+    static constexpr std::uint32_t byte_order_mark = 0x01020304;
+
+    char magic[8];              // "VRPNORMS"
+    std::uint32_t version;
+    std::uint32_t byte_order;   // byte_order_mark as written by the producer
+    std::uint64_t seed;
+    std::uint64_t count;        // number of doubles in the payload
+    std::uint64_t checksum;     // normal_store_checksum of the payload
+    std::uint8_t reserved[24];  // pads the header to 64 bytes
+};
+
+/// FNV-1a hash over the 64-bit words of n doubles.
+std::uint64_t normal_store_checksum(const double* data, std::size_t n);
+
+/// Writes count standard Normal draws from RandomEngine(seed) to path.
+void write_normal_store(
+    const std::string& path, 
+    std::size_t count, 
+    unsigned int seed
+);
+
+/// Read-only, memory-mapped normal store that serves blocks in place.
+class MappedNormalStore final : public NormalSource
+{
+public: 
+    /// Maps the file at path; verify recomputes the payload checksum.
+    explicit MappedNormalStore(const std::string& path, bool verify = true);
+    ~MappedNormalStore() override;
+
+    MappedNormalStore(const MappedNormalStore&) = delete;
+    MappedNormalStore& operator=(const MappedNormalStore&) = delete;
+
+    double normal() override;
+    void fill(double* out, std::size_t n) override;
+
+    /// Returns a pointer into the mapping; scratch is never written.
+    const double* next_block(double* scratch, std::size_t n) override;
+
+    /// Moves the read cursor to the given draw index.
+    void seek(std::size_t index);
+
+    std::size_t size() const { return count_; }
+    std::size_t position() const { return position_; }
+    std::uint64_t seed() const { return seed_; }
+    const double* data() const { return data_; }
+
+private: 
+    void require(std::size_t n) const;
+
+    void* mapping_ = nullptr;
+    std::size_t mapping_size_ = 0;
+    const double* data_ = nullptr;
+    std::size_t count_ = 0;
+    std::size_t position_ = 0;
+    std::uint64_t seed_ = 0;
+};
@@ -6,10 +6,19 @@
 class OnlineStatistics
 {
 public: 
+    OnlineStatistics() = default;
+
+    /// Restores statistics from a count, mean and sum of squared deviations.
+    static OnlineStatistics from_moments(std::size_t n, double mean, double m2);
+
     void add(double x); 
 
+    /// Combines with statistics over disjoint samples (Chan et al.).
+    void merge(const OnlineStatistics& other);
+
     std::size_t count() const { return n_; } 
     double mean() const { return mean_; }
+    double m2() const { return m2_; }
     double variance() const; 
     double standard_error() const; 
 
@@ -17,4 +26,4 @@ private:
     std::size_t n_ = 0; 
     double mean_ = 0.0; 
     double m2_ = 0.0; 
-};
\ No newline at end of file
+};
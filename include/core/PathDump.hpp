@@ -0,0 +1,119 @@
+#pragma once
+#include "core/EngineObserver.hpp"
+#include "samplers/PathSampler.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Columns of a path dump, in their order within each chunk.
+enum class PathColumn { Z = 0, Terminal, Payoff, Control };
+
+/// On-disk layout of a path dump: a fixed header followed by chunks of 
+/// chunk_rows paths, each chunk storing its columns back to back. Only the 
+/// last chunk may be short.
+struct PathDumpHeader
+{
+    static constexpr std::uint32_t current_version = 1;
+    static constexpr std::uint32_t byte_order_mark = 0x01020304;
+    static constexpr std::uint32_t column_count = 4;
+
+    char magic[8];              // "VRPPATHS"
+    std::uint32_t version;
+    std::uint32_t byte_order;   // byte_order_mark as written by the producer
+    std::uint32_t columns;
+    std::uint32_t chunk_rows; 
+    std::uint64_t count;        // number of paths
+    std::uint8_t reserved[32];  // pads the header to 64 bytes
+};
+
+/// Engine observer streaming per-path columns to a binary file.
+/// The engine samples through PathSampler::record while the writer is 
+/// attached, so the terminal price and payoffs come from the run itself. 
+/// observe() copies them into a chunk; a writer thread lays the chunk out 
+/// as columns and writes it. At most max_pending full chunks are queued 
+/// before observe() waits.
+class PathDumpWriter : public EngineObserver
+{
+public: 
+    /// Throws invalid_argument unless sampler.records_paths(), since other 
+    /// samplers have no terminal price to dump.
+    PathDumpWriter(
+        const std::string& path, 
+        const PathSampler& sampler, 
+        std::size_t chunk_rows = 1 << 16, 
+        std::size_t max_pending = 4
+    );
+    ~PathDumpWriter() override;
+
+    PathDumpWriter(const PathDumpWriter&) = delete;
+    PathDumpWriter& operator=(const PathDumpWriter&) = delete;
+
+    void observe(const PathBlock& block) override;
+    bool wants_records() const override { return true; }
+
+    /// Flushes the last chunk, finalises the header and rethrows any 
+    /// error from the writer thread. Called by the destructor if needed.
+    void close();
+
+    std::size_t count() const { return count_; }
+
+private: 
+    void submit();
+    void write_loop();
+    void write_chunk(const std::vector<double>& rows, std::vector<double>& columns);
+
+    std::string path_;
+    std::size_t chunk_rows_; 
+    std::size_t max_pending_; 
+    std::ofstream out_;
+
+    std::vector<double> current_;     // column_count values per path, row by row
+    std::size_t count_ = 0;
+    bool closed_ = false;
+
+    std::mutex mutex_; 
+    std::condition_variable cv_; 
+    std::deque<std::vector<double>> pending_; 
+    std::vector<std::vector<double>> spare_; 
+    bool finishing_ = false; 
+    std::exception_ptr error_;
+    std::thread writer_;
+};
+
+/// Read-only, memory-mapped view of a path dump.
+class PathDumpReader
+{
+public: 
+    explicit PathDumpReader(const std::string& path);
+    ~PathDumpReader();
+
+    PathDumpReader(const PathDumpReader&) = delete;
+    PathDumpReader& operator=(const PathDumpReader&) = delete;
+
+    std::size_t size() const { return count_; }
+    std::size_t chunk_rows() const { return chunk_rows_; }
+    std::size_t n_chunks() const { return (count_ + chunk_rows_ - 1) / chunk_rows_; }
+
+    /// Number of paths in the given chunk.
+    std::size_t chunk_size(std::size_t chunk) const;
+
+    /// Contiguous column of the given chunk, pointing into the mapping.
+    const double* column(std::size_t chunk, PathColumn column) const;
+
+    /// Value of a column for path i.
+    double value(PathColumn column, std::size_t i) const;
+
+private: 
+    void* mapping_ = nullptr;
+    std::size_t mapping_size_ = 0;
+    const double* data_ = nullptr;
+    std::size_t count_ = 0;
+    std::size_t chunk_rows_ = 0;
+};
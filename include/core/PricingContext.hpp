@@ -0,0 +1,50 @@
+#pragma once
+#include "options/OptionType.hpp"
+#include "core/RandomEngine.hpp"
+#include <cstddef>
+#include <vector>
+
+/// Inputs of one European quote under Black-Scholes.
+struct PricingRequest
+{
+    double spot; 
+    double strike; 
+    double volatility; 
+    double rate; 
+    double maturity; 
+    OptionType type; 
+    std::size_t n_paths;
+};
+
+/// Discounted price and its standard error.
+struct PricingQuote
+{
+    double price; 
+    double standard_error; 
+    double beta;            // control coefficient used
+};
+
+/// Reusable low-latency pricer for single European quotes. The RNG and a 
+/// pool of ready Normal draws are created once, and price() does no heap 
+/// allocation. Each request runs one fused pass: ST is simulated once per 
+/// draw, with the underlying as control variate and beta estimated on the 
+/// same paths, which replaces the calibrate_beta pilot and sampler objects.
+class PricingContext
+{
+public: 
+    explicit PricingContext(unsigned int seed = 1310, std::size_t pool_size = 1 << 16);
+
+    /// Prices from the pool, drawing inline only once it runs dry.
+    PricingQuote price(const PricingRequest& request);
+
+    /// Regenerates the draws used so far; call between requests when idle.
+    void replenish();
+
+    /// Draws left in the pool before price() has to generate its own.
+    std::size_t available() const { return pool_.size() - cursor_; }
+
+private: 
+    RandomEngine rng_; 
+    std::vector<double> pool_;
+    std::size_t cursor_ = 0;
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include "core/EngineObserver.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// Mergeable streaming quantile sketch after Karnin, Lang & Liberty (KLL, 2016).
+/// Items live in compactors of geometrically shrinking capacity; a full 
+/// compactor sorts itself and promotes every other item (random offset) to 
+/// the next level with doubled weight. Memory stays around 3k items.
+/// Normalised rank error is O(1/k): about 1.65% for the default k = 200 at 
+/// 99% confidence, the bound DataSketches gives for KLL.
+class QuantileSketch : public EngineObserver
+{
+public: 
+    explicit QuantileSketch(std::size_t k = 200, std::uint64_t seed = 1310);
+
+    void add(double x);
+
+    /// Feeds every estimate of an engine block into the sketch.
+    void observe(const PathBlock& block) override;
+
+    /// Combines with a sketch built over disjoint samples.
+    void merge(const QuantileSketch& other);
+
+    std::size_t count() const { return n_; }
+    std::size_t retained() const { return retained_; }
+    double min() const { return min_; }
+    double max() const { return max_; }
+
+    /// Approximate q-quantile for q in [0, 1].
+    double quantile(double q) const;
+
+    /// Approximate fraction of samples at or below x.
+    double rank(double x) const;
+
+    /// Value at risk at confidence alpha (e.g. 0.99) of a P&L sample: 
+    /// the loss -quantile(1 - alpha).
+    double value_at_risk(double alpha) const;
+
+    /// Expected shortfall at confidence alpha of a P&L sample: 
+    /// the mean loss over the worst 1 - alpha tail.
+    double expected_shortfall(double alpha) const;
+
+private: 
+    struct Weighted 
+    {
+        double value; 
+        std::uint64_t weight;
+    };
+
+    std::size_t capacity(std::size_t level) const; 
+    void update_capacity();
+    void compress();
+    std::vector<Weighted> sorted_items() const;
+    bool coin();
+
+    std::size_t k_; 
+    std::vector<std::vector<double>> levels_; 
+    std::vector<std::size_t> capacities_;
+    std::size_t n_ = 0;
+    std::size_t retained_ = 0; 
+    std::size_t total_capacity_ = 0;
+    double min_; 
+    double max_;
+    std::uint64_t rng_state_;
+};
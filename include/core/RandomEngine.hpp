@@ -1,16 +1,18 @@
 # pragma once 
+#include "core/NormalSource.hpp"
 #include <random> 
 
 /// Random number generator using the Mersenne Twister.
-class RandomEngine 
+class RandomEngine final : public NormalSource
 {
 public: 
     explicit RandomEngine(unsigned int seed = 1310); 
     
-    double normal(); 
+    double normal() override; 
+    void fill(double* out, std::size_t n) override;
     void seed(unsigned int seed);
 
 private: 
     std::mt19937_64 generator_;
     std::normal_distribution<double> normal_{0.0, 1.0}; 
-};
\ No newline at end of file
+};
@@ -0,0 +1,61 @@
+#pragma once
+#include "models/BlackScholesModel.hpp"
+#include "options/Option.hpp"
+#include "core/OnlineStatistics.hpp"
+#include "core/NormalSource.hpp"
+#include <cstddef>
+#include <vector>
+
+/// Shifts spanning a scenario grid: each (spot, vol, rate) triple is one scenario.
+struct ScenarioGrid
+{
+    std::vector<double> spot_shifts{0.0};   // relative, spot * (1 + shift)
+    std::vector<double> vol_shifts{0.0};    // absolute, volatility + shift
+    std::vector<double> rate_shifts{0.0};   // absolute, rate + shift
+};
+
+/// Discounted prices over a scenario grid, indexed by (spot, vol, rate) shift.
+class ScenarioSurface
+{
+public: 
+    ScenarioSurface(const ScenarioGrid& grid, double maturity, double rate);
+
+    double price(std::size_t spot, std::size_t vol, std::size_t rate) const;
+    double standard_error(std::size_t spot, std::size_t vol, std::size_t rate) const;
+
+    /// Undiscounted payoff statistics for a scenario.
+    OnlineStatistics& stats(std::size_t spot, std::size_t vol, std::size_t rate);
+    const OnlineStatistics& stats(std::size_t spot, std::size_t vol, std::size_t rate) const;
+
+    std::size_t n_spot() const { return n_spot_; }
+    std::size_t n_vol() const { return n_vol_; }
+    std::size_t n_rate() const { return discount_.size(); }
+
+private: 
+    std::size_t index(std::size_t spot, std::size_t vol, std::size_t rate) const;
+
+    std::size_t n_spot_; 
+    std::size_t n_vol_; 
+    std::vector<double> discount_;    // discount factor per rate shift
+    std::vector<OnlineStatistics> stats_;
+};
+
+/// Reprices an option over a scenario grid on common random numbers. 
+/// Each draw Z is shared by every scenario: exp(vol * sqrt(T) * Z) is computed 
+/// once per vol shift, and spot and rate shifts only rescale it.
+class ScenarioEngine
+{
+public: 
+    ScenarioEngine(
+        const BlackScholesModel& model, 
+        const Option& option, 
+        ScenarioGrid grid
+    );
+
+    ScenarioSurface run(std::size_t n_paths, NormalSource& rng) const;
+
+private: 
+    const BlackScholesModel& model_; 
+    const Option& option_; 
+    ScenarioGrid grid_;
+};
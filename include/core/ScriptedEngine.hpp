@@ -0,0 +1,28 @@
+#pragma once
+#include "models/BlackScholesModel.hpp"
+#include "options/ScriptedOption.hpp"
+#include "core/OnlineStatistics.hpp"
+#include "core/NormalSource.hpp"
+#include <cstddef>
+
+/// Runs MC simulation of a scripted option, evolving a block of paths 
+/// through every observation date and interpreting the payoff once per block.
+class ScriptedEngine
+{
+public: 
+    /// Paths simulated per block.
+    static constexpr std::size_t block_size = 1024;
+
+    ScriptedEngine(
+        const BlackScholesModel& model, 
+        const ScriptedOption& option
+    );
+
+    /// Draws one block of Normals per date, so a single-date script sees 
+    /// the same draws as MonteCarloEngine with an MCSampler.
+    OnlineStatistics run(std::size_t n_paths, NormalSource& rng) const;
+
+private: 
+    const BlackScholesModel& model_; 
+    const ScriptedOption& option_;
+};
@@ -0,0 +1,71 @@
+#pragma once
+#include "samplers/PathSampler.hpp"
+#include "core/OnlineStatistics.hpp"
+#include "options/OptionType.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Deterministic partition of a run into fixed-size path blocks, dealt out 
+/// to shards as contiguous block ranges. Block b always covers paths 
+/// [b * block_size, (b + 1) * block_size) and draws from the same stream 
+/// positions, whichever shard simulates it.
+struct ShardPlan
+{
+    std::uint64_t n_paths; 
+    std::uint64_t n_shards = 1;
+    std::uint64_t block_size = 1 << 16;
+
+    std::uint64_t n_blocks() const;
+    std::uint64_t first_block(std::uint64_t shard) const;
+    std::uint64_t end_block(std::uint64_t shard) const;
+};
+
+/// Fingerprint of what a run simulates: the sampler kind and the trade 
+/// inputs. Shards only merge if their identities match.
+std::uint64_t run_identity(
+    std::string_view sampler, 
+    double spot, 
+    double strike, 
+    double rate, 
+    double volatility, 
+    double maturity, 
+    OptionType type
+);
+
+/// Per-block statistics produced by one shard.
+struct ShardResult
+{
+    std::uint64_t seed;
+    std::uint64_t identity;     // run_identity of the sampler and trade
+    ShardPlan plan;
+    std::uint64_t shard;
+    double discount;    // applied by the merge to report prices
+    std::vector<OnlineStatistics> blocks;
+};
+
+/// Simulates the blocks of one shard on a StreamRandomEngine(seed), 
+/// with one draw per path. identity is recorded for merge_shards.
+ShardResult run_shard(
+    const PathSampler& sampler, 
+    std::uint64_t seed, 
+    const ShardPlan& plan, 
+    std::uint64_t shard, 
+    double discount = 1.0, 
+    std::uint64_t identity = 0
+);
+
+void write_shard(const std::string& path, const ShardResult& result);
+ShardResult read_shard(const std::string& path);
+
+/// Folds one shard's block statistics in block order, e.g. to price a 
+/// shard on its own without the rest of the plan.
+OnlineStatistics shard_statistics(const ShardResult& shard);
+
+/// Checks that the shards belong to one run (same seed, plan, discount and 
+/// identity) and cover it exactly once, then 
+/// folds the block statistics in block order. The fold does not depend on 
+/// the number of shards, so the result is bitwise identical to one shard.
+OnlineStatistics merge_shards(const std::vector<ShardResult>& shards);
@@ -0,0 +1,32 @@
+#pragma once
+#include "core/NormalSource.hpp"
+#include <cstdint>
+
+/// Counter-based Normal stream: draw i is a pure function of (seed, i), so 
+/// the stream can jump to any position in O(1). Uniforms come from the 
+/// SplitMix64 output function and are mapped through the inverse Normal CDF 
+/// (Wichura's AS241), so every draw consumes exactly one counter.
+class StreamRandomEngine final : public NormalSource
+{
+public: 
+    explicit StreamRandomEngine(std::uint64_t seed = 1310); 
+
+    double normal() override; 
+    void fill(double* out, std::size_t n) override;
+
+    /// Moves the stream to draw index.
+    void seek(std::uint64_t index) { counter_ = index; }
+    std::uint64_t position() const { return counter_; }
+    std::uint64_t seed() const { return seed_; }
+
+    /// Draw at index without moving the stream.
+    double at(std::uint64_t index) const;
+
+private: 
+    std::uint64_t seed_;
+    std::uint64_t key_;
+    std::uint64_t counter_ = 0;
+};
+
+/// Inverse of the standard Normal CDF for p in (0, 1).
+double inverse_normal_cdf(double p);
@@ -0,0 +1,141 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Active;
+
+/// Reverse-mode AAD tape. Each recorded operation stores up to two parent 
+/// nodes and the local partial derivatives towards them. Node and adjoint 
+/// storage are arenas: reset() rewinds them without freeing, so a path 
+/// loop allocates only while the tape grows to its high-water mark.
+class Tape
+{
+public: 
+    static constexpr std::uint32_t no_parent = UINT32_MAX;
+
+    struct Node
+    {
+        double partial[2]; 
+        std::uint32_t parent[2];
+    };
+
+    /// The calling thread's tape; Active operations record onto it.
+    static Tape& current();
+
+    /// Registers an independent input.
+    Active variable(double value);
+
+    /// Forgets every node, keeping the allocated capacity.
+    void reset() { nodes_.clear(); }
+
+    /// Runs the adjoint sweep from output, seeding its adjoint with one.
+    void propagate(const Active& output);
+
+    /// d(output)/d(x) after propagate; zero for constants.
+    double adjoint(const Active& x) const;
+
+    std::size_t size() const { return nodes_.size(); }
+    std::size_t capacity() const { return nodes_.capacity(); }
+
+    std::uint32_t record(
+        std::uint32_t a, double da, 
+        std::uint32_t b = no_parent, double db = 0.0
+    )
+    {
+        nodes_.push_back({{da, db}, {a, b}});
+        return static_cast<std::uint32_t>(nodes_.size() - 1);
+    }
+
+private: 
+    std::vector<Node> nodes_; 
+    std::vector<double> adjoints_;
+};
+
+/// Active number: a value plus its node on the thread's tape. Constants 
+/// carry no node and are never recorded.
+class Active
+{
+public: 
+    Active(double value = 0.0) : value_(value) {}
+    Active(double value, std::uint32_t node) : value_(value), node_(node) {}
+
+    double value() const { return value_; }
+    std::uint32_t node() const { return node_; }
+    bool is_constant() const { return node_ == Tape::no_parent; }
+
+    Active& operator+=(const Active& x) { return *this = *this + x; }
+    Active& operator-=(const Active& x) { return *this = *this - x; }
+    Active& operator*=(const Active& x) { return *this = *this * x; }
+    Active& operator/=(const Active& x) { return *this = *this / x; }
+
+    friend Active unary(const Active& x, double value, double dx)
+    {
+        if (x.is_constant())
+            return Active(value);
+        return Active(value, Tape::current().record(x.node_, dx));
+    }
+
+    friend Active binary(
+        const Active& x, const Active& y, 
+        double value, double dx, double dy
+    )
+    {
+        if (x.is_constant())
+            return unary(y, value, dy);
+        if (y.is_constant())
+            return unary(x, value, dx);
+        return Active(value, Tape::current().record(x.node_, dx, y.node_, dy));
+    }
+
+    friend Active operator+(const Active& x, const Active& y)
+    {
+        return binary(x, y, x.value_ + y.value_, 1.0, 1.0);
+    }
+    friend Active operator-(const Active& x, const Active& y)
+    {
+        return binary(x, y, x.value_ - y.value_, 1.0, -1.0);
+    }
+    friend Active operator*(const Active& x, const Active& y)
+    {
+        return binary(x, y, x.value_ * y.value_, y.value_, x.value_);
+    }
+    friend Active operator/(const Active& x, const Active& y)
+    {
+        double inv = 1.0 / y.value_;
+        return binary(x, y, x.value_ * inv, inv, -x.value_ * inv * inv);
+    }
+    friend Active operator-(const Active& x)
+    {
+        return unary(x, -x.value_, -1.0);
+    }
+
+    friend Active exp(const Active& x)
+    {
+        double e = std::exp(x.value_);
+        return unary(x, e, e);
+    }
+    friend Active log(const Active& x)
+    {
+        return unary(x, std::log(x.value_), 1.0 / x.value_);
+    }
+    friend Active sqrt(const Active& x)
+    {
+        double s = std::sqrt(x.value_);
+        return unary(x, s, 0.5 / s);
+    }
+
+    /// Routes the derivative through the larger argument.
+    friend Active max(const Active& x, const Active& y)
+    {
+        return x.value_ >= y.value_ ? x : y;
+    }
+
+    friend bool operator<(const Active& x, const Active& y) { return x.value_ < y.value_; }
+    friend bool operator>(const Active& x, const Active& y) { return x.value_ > y.value_; }
+
+private: 
+    double value_; 
+    std::uint32_t node_ = Tape::no_parent;
+};
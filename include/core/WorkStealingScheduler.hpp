@@ -0,0 +1,64 @@
+#pragma once
+#include "samplers/PathSampler.hpp"
+#include "core/OnlineStatistics.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/// One trade in a pricing batch.
+struct PricingJob
+{
+    /// Builds the sampler. Runs as the job's first task, so pilot 
+    /// calibrations are scheduled and balanced like any other work.
+    std::function<std::unique_ptr<PathSampler>()> make_sampler;
+    std::uint64_t n_paths;
+    std::uint64_t seed = 1310;
+};
+
+/// Scheduler settings.
+struct SchedulerConfig
+{
+    std::size_t n_threads = 0;          // 0 uses every hardware thread
+    std::uint64_t block_size = 1 << 14; // paths per task
+    bool steal = true;                  // false keeps every task on its owner
+    bool pin_threads = false;           // pin worker k to CPU k (Linux only)
+};
+
+/// Timing of one batch.
+struct SchedulerReport
+{
+    double makespan = 0.0;              // wall seconds for the batch
+    std::vector<double> busy;           // seconds spent in tasks, per worker
+    std::size_t steals = 0;
+
+    /// Fraction of worker time spent running tasks.
+    double utilization() const;
+};
+
+/// Prices batches of heterogeneous jobs on a pool of workers, each owning a 
+/// deque of path-block tasks. Owners pop their newest task; idle workers 
+/// steal the oldest task of another worker, or sleep until new tasks are 
+/// pushed when there is nothing to steal. Block b of a job simulates paths 
+/// [b * block_size, (b + 1) * block_size) from StreamRandomEngine(seed), and 
+/// the blocks are folded in order once the last one finishes, so results 
+/// do not depend on the thread count or on which worker ran what.
+class WorkStealingScheduler
+{
+public: 
+    explicit WorkStealingScheduler(SchedulerConfig config = {});
+
+    /// Prices every job and returns its undiscounted payoff statistics. 
+    /// If a task throws, the other workers stop taking tasks and the first 
+    /// exception is rethrown once every worker has joined.
+    std::vector<OnlineStatistics> run(
+        const std::vector<PricingJob>& jobs, 
+        SchedulerReport* report = nullptr
+    ) const;
+
+    std::size_t n_threads() const { return config_.n_threads; }
+
+private: 
+    SchedulerConfig config_;
+};
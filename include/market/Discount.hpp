@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 
 /// Abstract interface for discount curves.
 /// Evaluates the discount factor at a given time to maturity T (in years).
@@ -7,4 +8,12 @@ class Discount
 public: 
     virtual ~Discount()= default; 
     virtual double operator()(double T) const = 0;
-};
\ No newline at end of file
+
+    /// Writes the discount factors for n maturities T to df.
+    /// Curves are fastest when T is sorted in increasing order.
+    virtual void evaluate(const double* T, double* df, std::size_t n) const
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            df[i] = (*this)(T[i]);
+    }
+};
@@ -10,9 +10,23 @@ public:
 
     double operator()(double T) const override 
     {
-        return std::exp(-r_ * T);
+        return discount_factor(r_, T);
+    }
+
+    /// Discount factor for double or Active rate and maturity.
+    template <class Real>
+    static Real discount_factor(const Real& r, const Real& T)
+    {
+        using std::exp;
+        return exp(-r * T);
+    }
+
+    void evaluate(const double* T, double* df, std::size_t n) const override
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            df[i] = std::exp(-r_ * T[i]);
     }
 
 private: 
     double r_;
-};  
\ No newline at end of file
+};  
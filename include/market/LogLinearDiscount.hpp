@@ -0,0 +1,32 @@
+#pragma once
+#include "market/PiecewiseDiscount.hpp"
+#include <vector>
+
+/// Discount curve interpolating log discount factors linearly between pillars 
+/// (piecewise flat forwards), extrapolated flat beyond the last pillar.
+class LogLinearDiscount final : public PiecewiseDiscount
+{
+public: 
+    static LogLinearDiscount from_zero_rates(
+        const std::vector<double>& times, 
+        const std::vector<double>& rates
+    );
+
+    static LogLinearDiscount from_discount_factors(
+        const std::vector<double>& times, 
+        const std::vector<double>& factors
+    );
+
+    double operator()(double T) const override; 
+    void evaluate(const double* T, double* df, std::size_t n) const override;
+
+private: 
+    LogLinearDiscount(
+        const std::vector<double>& times, 
+        const std::vector<double>& log_discount
+    );
+
+    // log DF(T) = intercept_[i] + slope_[i] * T on segment i
+    std::vector<double> intercept_; 
+    std::vector<double> slope_; 
+};
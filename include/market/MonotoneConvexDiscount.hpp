@@ -0,0 +1,60 @@
+#pragma once
+#include "market/PiecewiseDiscount.hpp"
+#include <vector>
+
+/// Discount curve using the monotone convex method of Hagan & West (2006):
+/// instantaneous forwards are continuous, positive where the discrete forwards 
+/// allow, and reproduce every pillar exactly. Where two adjacent discrete 
+/// forwards are equal the method degenerates and the forward steps at the pillar. The last instantaneous forward 
+/// is extrapolated flat. The optional forward positivity collar is not applied.
+class MonotoneConvexDiscount final : public PiecewiseDiscount
+{
+public: 
+    static MonotoneConvexDiscount from_zero_rates(
+        const std::vector<double>& times, 
+        const std::vector<double>& rates
+    );
+
+    static MonotoneConvexDiscount from_discount_factors(
+        const std::vector<double>& times, 
+        const std::vector<double>& factors
+    );
+
+    double operator()(double T) const override; 
+    void evaluate(const double* T, double* df, std::size_t n) const override;
+
+    /// Instantaneous forward rate at T.
+    double forward(double T) const;
+
+private: 
+    /// Shape of the forward correction g(x) on a segment, per Hagan & West.
+    enum class Region { Flat, Quadratic, FlatHead, FlatTail, Trough };
+
+    struct Segment 
+    {
+        double start;           // left pillar
+        double width;           // pillar spacing
+        double log_discount;    // log DF at the left pillar
+        double forward;         // discrete forward over the segment
+        double g0;              // instantaneous forward minus discrete, left 
+        double g1;              // instantaneous forward minus discrete, right
+        double eta;             // switch point of the piecewise shapes
+        double A;               // trough level for Region::Trough
+        Region region; 
+    };
+
+    explicit MonotoneConvexDiscount(
+        const std::vector<double>& times, 
+        const std::vector<double>& log_discount
+    );
+
+    double log_discount(std::size_t i, double T) const; 
+
+    /// Integral of g over [0, x] on segment s.
+    static double integral(const Segment& s, double x);
+    static double correction(const Segment& s, double x);
+
+    std::vector<Segment> segments_;
+    double last_log_discount_; 
+    double last_forward_;
+};
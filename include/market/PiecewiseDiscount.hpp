@@ -0,0 +1,63 @@
+#pragma once
+#include "market/Discount.hpp"
+#include <cstddef>
+#include <vector>
+
+/// Base for discount curves interpolated between pillar maturities.
+/// Segment lookup goes through a uniform bucket table over the pillars, so 
+/// locating T takes a multiply, a load and at most a short forward scan.
+class PiecewiseDiscount : public Discount
+{
+public: 
+    /// Pillar maturities, with the curve origin 0 prepended.
+    const std::vector<double>& times() const { return times_; }
+
+protected: 
+    /// Takes strictly increasing, positive pillar maturities.
+    explicit PiecewiseDiscount(const std::vector<double>& times);
+
+    /// Index i of the segment (times_[i], times_[i + 1]] containing T; 
+    /// returns the number of pillars for T beyond the last one.
+    std::size_t segment(double T) const
+    {
+        double x = T * inv_width_;
+        std::size_t b = x < 0.0 ? 0 
+                      : x < last_bucket_ ? static_cast<std::size_t>(x) 
+                      : buckets_.size() - 1;
+        return scan(buckets_[b], T);
+    }
+
+    /// Advances from segment i to the one containing T >= times_[i].
+    std::size_t scan(std::size_t i, double T) const
+    {
+        while (i < n_pillars_ && T > times_[i + 1])
+            ++i;
+        return i;
+    }
+
+    /// Segment for T given the segment of the previous, smaller maturity.
+    std::size_t next_segment(std::size_t i, double T_prev, double T) const
+    {
+        return T >= T_prev ? scan(i, T) : segment(T);
+    }
+
+    std::vector<double> times_;     // 0, t_1, ..., t_n 
+    std::size_t n_pillars_;
+
+private: 
+    std::vector<std::size_t> buckets_;
+    double inv_width_; 
+    double last_bucket_;
+};
+
+/// Converts continuously compounded zero rates to log discount factors.
+std::vector<double> log_discount_from_zero_rates(
+    const std::vector<double>& times, 
+    const std::vector<double>& rates
+);
+
+/// Takes the logarithm of positive discount factors.
+std::vector<double> log_discount_from_factors(
+    const std::vector<double>& times, 
+    const std::vector<double>& factors
+);
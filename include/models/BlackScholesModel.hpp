@@ -1,6 +1,7 @@
 #pragma once 
 #include "models/Model.hpp"
 #include "core/RandomEngine.hpp"
+#include <cmath>
 
 /// Black-Scholes asset model (geometric Brownian motion).
 class BlackScholesModel : public Model
@@ -15,6 +16,23 @@ public:
     /// Simulate asset price at time t with standard Normal r.v. Z.
     double simulate(double t, double Z) const override; 
 
+    /// Terminal price as a function of every input, for double or Active.
+    template <class Real>
+    static Real simulate(
+        const Real& spot, 
+        const Real& rate, 
+        const Real& volatility, 
+        const Real& t, 
+        double Z
+    )
+    {
+        using std::exp; 
+        using std::sqrt;
+        return spot * exp(
+            (rate - 0.5 * volatility * volatility) * t + volatility * sqrt(t) * Z
+        );
+    }
+
     double spot() const { return spot_; }
     double rate() const { return rate_; }
     double volatility() const { return vol_; }
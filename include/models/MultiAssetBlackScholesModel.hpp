@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+/// Correlated multi-asset Black-Scholes model (one GBM per asset).
+/// Blocks of draws are stored path-major: row p holds the n_assets draws of path p.
+class MultiAssetBlackScholesModel
+{
+public: 
+    /// Correlation is a row-major n_assets x n_assets positive definite matrix.
+    MultiAssetBlackScholesModel(
+        std::vector<double> spots, 
+        double rate, 
+        std::vector<double> volatilities, 
+        const std::vector<double>& correlation
+    );
+
+    /// Applies the Cholesky factor to n_paths rows of independent draws Z, 
+    /// writing correlated draws to W as the cache-blocked product W = Z L^T.
+    void correlate(const double* Z, double* W, std::size_t n_paths) const;
+
+    /// Maps n_paths rows of correlated draws W to asset prices at time t, in place.
+    void simulate_block(double t, double* W, std::size_t n_paths) const;
+
+    std::size_t n_assets() const { return spots_.size(); }
+    const std::vector<double>& spots() const { return spots_; }
+    double rate() const { return rate_; }
+    const std::vector<double>& volatilities() const { return vols_; }
+
+    /// Transposed lower Cholesky factor, row-major: entry (j, i) is L(i, j).
+    const std::vector<double>& cholesky_transposed() const { return chol_t_; }
+
+private: 
+    std::vector<double> spots_; 
+    double rate_; 
+    std::vector<double> vols_;
+    std::vector<double> log_drift_;     // rate - vol^2 / 2 per asset
+    std::vector<double> chol_t_; 
+};
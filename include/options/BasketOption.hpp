@@ -0,0 +1,31 @@
+#pragma once
+#include "options/MultiAssetOption.hpp"
+#include "options/OptionType.hpp"
+#include <cstddef>
+#include <vector>
+
+/// Option on a weighted sum of terminal prices.
+class BasketOption : public MultiAssetOption
+{
+public: 
+    BasketOption(
+        std::vector<double> weights, 
+        double strike, 
+        double maturity, 
+        OptionType type
+    ); 
+
+    double payoff(const double* ST) const override; 
+    double maturity() const override { return maturity_; }
+    std::size_t n_assets() const override { return weights_.size(); }
+
+    const std::vector<double>& weights() const { return weights_; }
+    double strike() const { return strike_; }
+    OptionType type() const { return type_; }
+
+private: 
+    std::vector<double> weights_;
+    double strike_; 
+    double maturity_; 
+    OptionType type_; 
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include "options/Option.hpp"
+#include "options/OptionType.hpp"
+#include <cstddef>
+#include <vector>
+
+/// Vanilla option exercisable on a set of dates; the last date is maturity.
+class BermudanOption : public Option
+{
+public: 
+    BermudanOption(
+        double strike, 
+        std::vector<double> exercise_dates, 
+        OptionType type
+    ); 
+
+    /// Approximates an American option with n_dates equally spaced dates.
+    static BermudanOption american(
+        double strike, 
+        double maturity, 
+        std::size_t n_dates, 
+        OptionType type
+    );
+
+    /// Exercise value given underlying price ST.
+    double payoff(double ST) const override; 
+    double maturity() const override { return dates_.back(); }
+
+    const std::vector<double>& exercise_dates() const { return dates_; }
+    double strike() const { return strike_; }
+    OptionType type() const { return type_; }
+
+private: 
+    double strike_; 
+    std::vector<double> dates_; 
+    OptionType type_; 
+};
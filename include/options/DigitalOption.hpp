@@ -14,9 +14,18 @@ public:
 
     /// Payoff at maturity given underlying price ST.
     double payoff(double ST) const override; 
+
+    /// Payoff for double or Active terminal prices; its derivative is zero.
+    template <class Real>
+    Real payoff(const Real& ST) const
+    {
+        bool in_money = (type_ == OptionType::Call) ? ST > strike_ : ST < strike_;
+        return Real(in_money ? payout_ : 0.0);
+    }
     double maturity() const override { return maturity_; }
 
     double strike() const { return strike_; }
+    double payout() const { return payout_; }
     OptionType type() const { return type_; }
 
 private: 
@@ -1,6 +1,7 @@
 #pragma once
 #include "options/Option.hpp"
 #include "options/OptionType.hpp"
+#include <algorithm>
 
 /// European option (vanilla, payoff depends on terminal price only).
 class EuropeanOption : public Option
@@ -14,6 +15,17 @@ public:
     
     /// Payoff at maturity given underlying price ST.
     double payoff(double ST) const override; 
+
+    /// Payoff for double or Active terminal prices.
+    template <class Real>
+    Real payoff(const Real& ST) const
+    {
+        using std::max;
+        if (type_ == OptionType::Call)
+            return max(ST - strike_, Real(0.0));
+        else 
+            return max(strike_ - ST, Real(0.0)); 
+    }
     double maturity() const override { return maturity_; }
 
     double strike() const { return strike_; }
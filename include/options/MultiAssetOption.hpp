@@ -0,0 +1,16 @@
+#pragma once 
+#include <cstddef>
+
+/// Abstract interface for an option on several underlyings.
+class MultiAssetOption
+{ 
+public: 
+    virtual ~MultiAssetOption() = default; 
+
+    /// Payoff at maturity given the terminal prices ST of every asset.
+    virtual double payoff(const double* ST) const = 0; 
+    virtual double maturity() const = 0; 
+
+    /// Number of assets the payoff reads: ST must hold at least this many.
+    virtual std::size_t n_assets() const = 0;
+};
@@ -0,0 +1,72 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// Payoff expression compiled to stack bytecode and evaluated a block of 
+/// paths per instruction, so dispatch is paid once per block.
+///
+/// Grammar, loosest binding first:
+///     expr    := sum (('<' | '<=' | '>' | '>=') sum)?   comparisons give 1 or 0
+///     sum     := product (('+' | '-') product)*
+///     product := unary (('*' | '/') unary)*
+///     unary   := '-' unary | primary
+///     primary := number | 'ST' | 'S' '[' index ']' | '(' expr ')'
+///              | max(expr, ...) | min(expr, ...) | abs(expr) | exp(expr) 
+///              | log(expr) | if(cond, then, else)
+/// S[k] is the path value at the k-th observation date and ST the last one.
+/// e.g. "max(ST - 100, 0)", "10 * (ST > 105)", "max((S[0] + S[1] + S[2]) / 3 - 100, 0)"
+class PayoffScript
+{
+public: 
+    enum class Op : std::uint8_t
+    {
+        Load,               // push observation column arg, terminal for ST
+        Const,              // push constant arg
+        Add, Sub, Mul, Div, Max, Min, Less, LessEq, Greater, GreaterEq,
+        AddC, SubC, RSubC, MulC, DivC, MaxC, MinC,      // top op constant arg
+        LessC, LessEqC, GreaterC, GreaterEqC, 
+        Neg, Abs, Exp, Log, 
+        Select              // cond ? then : else, popping three
+    };
+
+    static constexpr std::uint32_t terminal = UINT32_MAX;
+    static constexpr std::size_t max_stack_depth = 64;
+
+    struct Instruction
+    {
+        Op op; 
+        std::uint32_t arg;
+    };
+
+    /// Parses and compiles source; throws std::invalid_argument on syntax errors.
+    explicit PayoffScript(const std::string& source);
+
+    /// Evaluates the payoff for n paths. observations[k] points to n values 
+    /// of S[k] for k < n_dates, the last being ST; scratch must hold 
+    /// scratch_size(n) doubles.
+    void evaluate(
+        const double* const* observations, 
+        std::size_t n_dates, 
+        std::size_t n, 
+        double* out, 
+        double* scratch
+    ) const;
+
+    std::size_t scratch_size(std::size_t n) const { return stack_depth_ * n; }
+
+    /// Fewest observation dates the script can run on: one more than its 
+    /// highest S[k].
+    std::size_t n_observations() const { return n_observations_; }
+
+    const std::string& source() const { return source_; }
+    const std::vector<Instruction>& code() const { return code_; }
+
+private: 
+    std::string source_;
+    std::vector<Instruction> code_; 
+    std::vector<double> constants_;
+    std::size_t stack_depth_ = 0; 
+    std::size_t n_observations_ = 1;
+};
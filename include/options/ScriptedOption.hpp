@@ -0,0 +1,34 @@
+#pragma once
+#include "options/Option.hpp"
+#include "options/PayoffScript.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/// Option whose payoff is a PayoffScript over increasing observation dates, 
+/// S[k] being the price at dates[k] and ST the price at the last date.
+class ScriptedOption : public Option
+{
+public: 
+    ScriptedOption(const std::string& source, std::vector<double> dates);
+    ScriptedOption(const std::string& source, double maturity);
+
+    /// Payoff at maturity given ST; only for scripts that read no earlier date.
+    double payoff(double ST) const override; 
+    double maturity() const override { return dates_.back(); }
+
+    /// Payoffs for n paths, observations[k] holding n prices at dates[k].
+    void payoff_block(
+        const double* const* observations, 
+        std::size_t n, 
+        double* out, 
+        double* scratch
+    ) const;
+
+    const PayoffScript& script() const { return script_; }
+    const std::vector<double>& dates() const { return dates_; }
+
+private: 
+    PayoffScript script_; 
+    std::vector<double> dates_;
+};
@@ -0,0 +1,31 @@
+#pragma once
+#include "options/MultiAssetOption.hpp"
+#include "options/OptionType.hpp"
+#include <cstddef>
+
+/// Option on the spread S_long(T) - S_short(T) between two assets.
+class SpreadOption : public MultiAssetOption
+{
+public: 
+    SpreadOption(
+        std::size_t long_asset, 
+        std::size_t short_asset, 
+        double strike, 
+        double maturity, 
+        OptionType type
+    ); 
+
+    double payoff(const double* ST) const override; 
+    double maturity() const override { return maturity_; }
+    std::size_t n_assets() const override;
+
+    double strike() const { return strike_; }
+    OptionType type() const { return type_; }
+
+private: 
+    std::size_t long_; 
+    std::size_t short_;
+    double strike_; 
+    double maturity_; 
+    OptionType type_; 
+};
@@ -0,0 +1,31 @@
+#pragma once
+#include "options/MultiAssetOption.hpp"
+#include "options/OptionType.hpp"
+#include <cstddef>
+#include <vector>
+
+/// Option on the worst performance min_i S_i(T) / reference_i, 
+/// with the strike quoted as a performance level (e.g. 1.0 at the money).
+class WorstOfOption : public MultiAssetOption
+{
+public: 
+    WorstOfOption(
+        std::vector<double> reference, 
+        double strike, 
+        double maturity, 
+        OptionType type
+    ); 
+
+    double payoff(const double* ST) const override; 
+    double maturity() const override { return maturity_; }
+    std::size_t n_assets() const override { return inv_reference_.size(); }
+
+    double strike() const { return strike_; }
+    OptionType type() const { return type_; }
+
+private: 
+    std::vector<double> inv_reference_;
+    double strike_; 
+    double maturity_; 
+    OptionType type_; 
+};
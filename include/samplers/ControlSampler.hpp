@@ -15,6 +15,8 @@ public:
 
     /// Evaluate option payoff with control variate adjustment.
     double sample(double Z) const override; 
+    double record(double Z, PathRecord& out) const override;
+    bool records_paths() const override;
 
 private: 
     std::unique_ptr<PathSampler> target_; 
@@ -0,0 +1,29 @@
+#pragma once
+#include "samplers/PathSampler.hpp"
+#include "models/Model.hpp"
+#include "options/Option.hpp"
+
+/// Antithetic control variate sampler: simulates the terminal price once for 
+/// Z and once for -Z, and applies the control adjustment to both payoffs.
+class FusedAntitheticControlSampler : public PathSampler
+{
+public: 
+    /// Throws invalid_argument if control and option maturities differ.
+    FusedAntitheticControlSampler(
+        const Model& model, 
+        const Option& option, 
+        const Option& control, 
+        double control_mean, 
+        double beta
+    );
+
+    /// Evaluate the average control-adjusted payoff of Z and -Z.
+    double sample(double Z) const override; 
+
+private: 
+    const Model& model_; 
+    const Option& option_;
+    const Option& control_;
+    double control_mean_;
+    double beta_;
+};
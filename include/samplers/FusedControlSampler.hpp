@@ -0,0 +1,32 @@
+#pragma once
+#include "samplers/PathSampler.hpp"
+#include "models/Model.hpp"
+#include "options/Option.hpp"
+
+/// Control variate sampler for a target and control option on the same model.
+/// Simulates the terminal price once per Z and feeds it to both payoffs, 
+/// where ControlSampler would simulate it once per wrapped sampler.
+class FusedControlSampler : public PathSampler
+{
+public: 
+    /// Throws invalid_argument if control and option maturities differ.
+    FusedControlSampler(
+        const Model& model, 
+        const Option& option, 
+        const Option& control, 
+        double control_mean, 
+        double beta
+    );
+
+    /// Evaluate option payoff with control variate adjustment.
+    double sample(double Z) const override; 
+    double record(double Z, PathRecord& out) const override;
+    bool records_paths() const override { return true; }
+
+private: 
+    const Model& model_; 
+    const Option& option_;
+    const Option& control_;
+    double control_mean_;
+    double beta_;
+};
@@ -15,6 +15,8 @@ public:
 
     /// Returns the option payoff.
     double sample(double Z) const override; 
+    double record(double Z, PathRecord& out) const override;
+    bool records_paths() const override { return true; }
 
 private: 
     const Model& model_; 
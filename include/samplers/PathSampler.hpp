@@ -1,4 +1,14 @@
 #pragma once 
+#include <limits>
+
+/// Per-path quantities behind a sample, for offline diagnostics.
+/// Fields a sampler does not produce are NaN.
+struct PathRecord
+{
+    double terminal; 
+    double payoff; 
+    double control;
+};
 
 /// Abstract interface for a Monte Carlo path sampler.
 class PathSampler
@@ -8,4 +18,18 @@ public:
 
     /// Returns a single path evaluation given standard normal Z.
     virtual double sample(double Z) const = 0;
-};
\ No newline at end of file
+
+    /// Fills the path's terminal price, payoff and control payoff and returns 
+    /// sample(Z). By default only the payoff is known, as the estimate itself.
+    virtual double record(double Z, PathRecord& out) const
+    {
+        double nan = std::numeric_limits<double>::quiet_NaN();
+        double estimate = sample(Z);
+        out = {nan, estimate, nan};
+        return estimate;
+    }
+
+    /// True if record() fills the terminal price and payoff of the path 
+    /// rather than the default estimate-only record.
+    virtual bool records_paths() const { return false; }
+};
@@ -0,0 +1,40 @@
+#pragma once
+#include "samplers/PathSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/DigitalOption.hpp"
+
+/// How the digital indicator is smoothed.
+enum class DigitalSmoothing
+{
+    ConditionalExpectation,     // integrate the last step of length width exactly
+    Kernel                      // Gaussian-smoothed indicator, bandwidth width in price
+};
+
+/// Digital option sampler with a smooth payoff, for lower variance and 
+/// usable pathwise Greeks. Conditional expectation simulates to T - width and 
+/// replaces the indicator by its probability over the final step, which is 
+/// unbiased. The kernel mode replaces it by N((ST - K) / width), biased by 
+/// O(width^2).
+class SmoothedDigitalSampler : public PathSampler
+{
+public: 
+    SmoothedDigitalSampler(
+        const BlackScholesModel& model, 
+        const DigitalOption& option, 
+        DigitalSmoothing smoothing, 
+        double width
+    );
+
+    /// Smoothed digital payoff given standard normal Z.
+    double sample(double Z) const override; 
+
+    /// Pathwise derivative of sample(Z) with respect to spot, undiscounted.
+    double pathwise_delta(double Z) const;
+
+private: 
+    const BlackScholesModel& model_; 
+    const DigitalOption& option_; 
+    DigitalSmoothing smoothing_; 
+    double width_;
+    double sign_;
+};
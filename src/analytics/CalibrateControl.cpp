@@ -5,10 +5,11 @@
 double calibrate_beta(
     PathSampler& target,
     PathSampler& control,
-    RandomEngine& rng,
+    NormalSource& rng,
     std::size_t max_samples, 
     std::size_t min_samples,
-    double error_target
+    double error_target, 
+    std::size_t* samples_used
 )
 {
     OnlineCovariance stats;
@@ -41,5 +42,7 @@ double calibrate_beta(
             }
         }
     }
+    if (samples_used)
+        *samples_used = stats.count();
     return beta;
 }
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "analytics/CalibrateModel.hpp"
+#include "core/RandomEngine.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+FrozenDrawCalibrator::FrozenDrawCalibrator(
+    const BlackScholesModel& model, 
+    const Discount& discount, 
+    std::vector<CalibrationQuote> quotes, 
+    std::size_t n_paths, 
+    std::uint64_t seed
+)
+: spot_(model.spot()), 
+  rate_(model.rate()), 
+  initial_vol_(model.volatility()), 
+  quotes_(std::move(quotes)), 
+  Z_(n_paths), 
+  ST_(block_size), 
+  dST_(block_size)
+{
+    if (quotes_.empty() || n_paths == 0)
+        throw std::invalid_argument("calibration needs quotes and paths");
+
+    // Group quotes by maturity so each expiry simulates ST once
+    for (std::size_t q = 0; q < quotes_.size(); ++q)
+    {
+        double T = quotes_[q].option.maturity(); 
+        auto it = std::find_if(expiries_.begin(), expiries_.end(), 
+            [T](const Expiry& e) { return e.maturity == T; });
+        if (it == expiries_.end())
+        {
+            expiries_.push_back({T, discount(T), {}});
+            it = expiries_.end() - 1;
+        }
+        it->quotes.push_back(q);
+    }
+
+    RandomEngine rng(seed); 
+    rng.fill(Z_.data(), n_paths);
+}
+
+void FrozenDrawCalibrator::evaluate(double volatility, double* prices, double* vegas)
+{
+    std::size_t n_paths = Z_.size(); 
+    for (const Expiry& expiry : expiries_)
+    {
+        double T = expiry.maturity; 
+        double sqrt_T = std::sqrt(T);
+        double drift = (rate_ - 0.5 * volatility * volatility) * T; 
+        double diffusion = volatility * sqrt_T; 
+
+        for (std::size_t q : expiry.quotes)
+            prices[q] = vegas[q] = 0.0;
+
+        for (std::size_t start = 0; start < n_paths; start += block_size)
+        {
+            std::size_t n = std::min(block_size, n_paths - start); 
+            const double* Z = Z_.data() + start; 
+
+            // dST/dvol = ST * (sqrt(T) Z - vol T)
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                ST_[i] = spot_ * std::exp(drift + diffusion * Z[i]);
+                dST_[i] = ST_[i] * (sqrt_T * Z[i] - volatility * T);
+            }
+
+            // Branch-free strike loops over the shared block
+            for (std::size_t q : expiry.quotes)
+            {
+                const EuropeanOption& option = quotes_[q].option; 
+                double sign = option.type() == OptionType::Call ? 1.0 : -1.0;
+                double K = option.strike(); 
+                double payoff_sum = 0.0; 
+                double vega_sum = 0.0; 
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    double intrinsic = sign * (ST_[i] - K); 
+                    bool in_money = intrinsic > 0.0;
+                    payoff_sum += in_money ? intrinsic : 0.0; 
+                    vega_sum += in_money ? sign * dST_[i] : 0.0;
+                }
+                prices[q] += payoff_sum; 
+                vegas[q] += vega_sum;
+            }
+        }
+
+        double scale = expiry.discount / static_cast<double>(n_paths);
+        for (std::size_t q : expiry.quotes)
+        {
+            prices[q] *= scale; 
+            vegas[q] *= scale;
+        }
+    }
+}
+
+VolCalibration FrozenDrawCalibrator::calibrate(
+    double tolerance, 
+    std::size_t max_iterations
+)
+{
+    std::vector<double> prices(quotes_.size()); 
+    std::vector<double> vegas(quotes_.size()); 
+    double vol = initial_vol_;
+    VolCalibration result{vol, 0.0, 0, false};
+
+    for (std::size_t it = 1; it <= max_iterations; ++it)
+    {
+        evaluate(vol, prices.data(), vegas.data());
+
+        // Gauss-Newton step for sum w (price - quote)^2
+        double gradient = 0.0; 
+        double curvature = 0.0; 
+        for (std::size_t q = 0; q < quotes_.size(); ++q)
+        {
+            double w = quotes_[q].weight; 
+            gradient += w * (prices[q] - quotes_[q].price) * vegas[q]; 
+            curvature += w * vegas[q] * vegas[q];
+        }
+        if (curvature <= 0.0)
+            break; 
+
+        // Halve the step rather than cross zero volatility
+        double step = -gradient / curvature; 
+        if (vol + step <= 0.0)
+            step = -0.5 * vol;
+        vol += step; 
+        result.iterations = it;
+
+        if (std::abs(step) < tolerance)
+        {
+            result.converged = true; 
+            break;
+        }
+    }
+
+    evaluate(vol, prices.data(), vegas.data());
+    double sse = 0.0; 
+    double weight = 0.0; 
+    for (std::size_t q = 0; q < quotes_.size(); ++q)
+    {
+        double residual = prices[q] - quotes_[q].price;
+        sse += quotes_[q].weight * residual * residual; 
+        weight += quotes_[q].weight;
+    }
+    result.volatility = vol; 
+    result.rmse = std::sqrt(sse / weight);
+    return result;
+}
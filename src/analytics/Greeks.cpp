@@ -1 +1,126 @@
-// WIP
\ No newline at end of file
+#include "analytics/Greeks.hpp"
+#include "market/FlatDiscount.hpp"
+#include "core/OnlineStatistics.hpp"
+#include "core/RandomEngine.hpp"
+#include "core/Tape.hpp"
+#include <algorithm>
+#include <vector>
+
+static constexpr std::size_t block_size = 4096;
+
+/// Discounted payoff of one path as a function of every model input.
+template <class Real>
+static Real discounted_payoff(
+    const EuropeanOption& option, 
+    const Real& spot, 
+    const Real& rate, 
+    const Real& volatility, 
+    const Real& maturity, 
+    double Z
+)
+{
+    Real ST = BlackScholesModel::simulate(spot, rate, volatility, maturity, Z);
+    return FlatDiscount::discount_factor(rate, maturity) * option.payoff(ST);
+}
+
+GreeksEstimate aad_greeks(
+    const BlackScholesModel& model, 
+    const EuropeanOption& option, 
+    std::size_t n_paths, 
+    NormalSource& rng
+)
+{
+    OnlineStatistics price, delta, vega, rho, theta; 
+    std::vector<double> scratch(std::min(n_paths, block_size));
+    Tape& tape = Tape::current();
+
+    for (std::size_t done = 0; done < n_paths; )
+    {
+        std::size_t n = std::min(block_size, n_paths - done);
+        const double* Z = rng.next_block(scratch.data(), n);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            // Rewind rather than free: the tape reuses its high-water capacity
+            tape.reset();
+            Active spot = tape.variable(model.spot()); 
+            Active rate = tape.variable(model.rate()); 
+            Active volatility = tape.variable(model.volatility()); 
+            Active maturity = tape.variable(option.maturity());
+
+            Active value = discounted_payoff(option, spot, rate, volatility, maturity, Z[i]);
+            tape.propagate(value);
+
+            price.add(value.value());
+            delta.add(tape.adjoint(spot)); 
+            vega.add(tape.adjoint(volatility)); 
+            rho.add(tape.adjoint(rate)); 
+            theta.add(-tape.adjoint(maturity));
+        }
+        done += n;
+    }
+
+    return {
+        {price.mean(), delta.mean(), vega.mean(), rho.mean(), theta.mean()}, 
+        {
+            price.standard_error(), delta.standard_error(), vega.standard_error(), 
+            rho.standard_error(), theta.standard_error()
+        }
+    };
+}
+
+/// Plain Monte Carlo price on draws from RandomEngine(seed).
+static double revalue(
+    const EuropeanOption& option, 
+    double spot, 
+    double rate, 
+    double volatility, 
+    double maturity, 
+    std::size_t n_paths, 
+    unsigned int seed
+)
+{
+    RandomEngine rng(seed); 
+    std::vector<double> Z(std::min(n_paths, block_size));
+    double sum = 0.0; 
+    for (std::size_t done = 0; done < n_paths; )
+    {
+        std::size_t n = std::min(block_size, n_paths - done);
+        rng.fill(Z.data(), n);
+        for (std::size_t i = 0; i < n; ++i)
+            sum += discounted_payoff(option, spot, rate, volatility, maturity, Z[i]);
+        done += n;
+    }
+    return sum / static_cast<double>(n_paths);
+}
+
+Greeks bump_greeks(
+    const BlackScholesModel& model, 
+    const EuropeanOption& option, 
+    std::size_t n_paths, 
+    unsigned int seed, 
+    double relative_bump
+)
+{
+    double S = model.spot(); 
+    double r = model.rate(); 
+    double v = model.volatility(); 
+    double T = option.maturity();
+    double hS = relative_bump * S; 
+    double hr = relative_bump * std::max(r, 0.01); 
+    double hv = relative_bump * v; 
+    double hT = relative_bump * T;
+
+    auto price = [&](double spot, double rate, double vol, double maturity)
+    {
+        return revalue(option, spot, rate, vol, maturity, n_paths, seed);
+    };
+
+    return {
+        price(S, r, v, T), 
+        (price(S + hS, r, v, T) - price(S - hS, r, v, T)) / (2 * hS), 
+        (price(S, r, v + hv, T) - price(S, r, v - hv, T)) / (2 * hv), 
+        (price(S, r + hr, v, T) - price(S, r - hr, v, T)) / (2 * hr), 
+        -(price(S, r, v, T + hT) - price(S, r, v, T - hT)) / (2 * hT)
+    };
+}
@@ -0,0 +1,81 @@
+#include "analytics/HestonClosedForm.hpp"
+#include <cmath>
+#include <complex>
+
+using complex = std::complex<double>;
+
+static constexpr double pi = 3.14159265358979323846;
+
+/// Characteristic function of log S(T).
+static complex heston_cf(
+    complex u, 
+    double S, 
+    double r, 
+    double v0, 
+    double kappa, 
+    double theta, 
+    double xi, 
+    double rho, 
+    double T
+)
+{
+    const complex i(0.0, 1.0);
+    complex beta = kappa - rho * xi * i * u;
+    complex d = std::sqrt(beta * beta + xi * xi * (i * u + u * u));
+    complex g = (beta - d) / (beta + d);
+    complex e = std::exp(-d * T);
+
+    complex C = kappa * theta / (xi * xi) 
+                * ((beta - d) * T - 2.0 * std::log((1.0 - g * e) / (1.0 - g)));
+    complex D = v0 / (xi * xi) * (beta - d) * (1.0 - e) / (1.0 - g * e);
+
+    return std::exp(i * u * (std::log(S) + r * T) + C + D);
+}
+
+double heston_price(
+    double S, 
+    double K, 
+    double r, 
+    double v0, 
+    double kappa, 
+    double theta, 
+    double xi, 
+    double rho, 
+    double T, 
+    OptionType type
+)
+{
+    const complex i(0.0, 1.0);
+    const double log_K = std::log(K);
+    const complex forward_cf = S * std::exp(r * T);   // cf at u = -i
+
+    // Composite Simpson on (0, u_max]; the integrands decay exponentially
+    const double u_max = 200.0;
+    const int n = 4000;
+    const double h = u_max / n;
+
+    double P1 = 0.0;
+    double P2 = 0.0;
+    for (int k = 0; k <= n; ++k)
+    {
+        double u = k == 0 ? 1e-10 : k * h;
+        double w = (k == 0 || k == n) ? 1.0 : (k % 2 ? 4.0 : 2.0);
+        complex kernel = std::exp(-i * u * log_K) / (i * u);
+
+        P1 += w * std::real(
+            kernel * heston_cf(u - i, S, r, v0, kappa, theta, xi, rho, T) 
+            / forward_cf
+        );
+        P2 += w * std::real(
+            kernel * heston_cf(u, S, r, v0, kappa, theta, xi, rho, T)
+        );
+    }
+    P1 = 0.5 + P1 * h / (3.0 * pi);
+    P2 = 0.5 + P2 * h / (3.0 * pi);
+
+    double call = S * P1 - K * std::exp(-r * T) * P2;
+    if (type == OptionType::Call)
+        return call;
+    else 
+        return call - S + K * std::exp(-r * T);
+}
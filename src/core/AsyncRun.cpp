@@ -0,0 +1,121 @@
+#include "core/AsyncRun.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include <algorithm>
+#include <vector>
+
+void AsyncRun::State::publish(const OnlineStatistics& stats, bool last)
+{
+    // Odd sequence marks a write in progress; readers retry around it
+    std::size_t seq = sequence.load(std::memory_order_relaxed);
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    paths_done.store(stats.count(), std::memory_order_relaxed);
+    mean.store(stats.mean(), std::memory_order_relaxed);
+    standard_error.store(
+        stats.count() > 1 ? stats.standard_error() : 0.0, 
+        std::memory_order_relaxed
+    );
+    finished.store(last, std::memory_order_relaxed);
+
+    sequence.store(seq + 2, std::memory_order_release);
+}
+
+AsyncRun::AsyncRun(
+    const PathSampler& sampler, 
+    std::vector<EngineObserver*> observers, 
+    std::size_t n_paths, 
+    NormalSource& rng, 
+    std::size_t publish_every
+)
+: state_(std::make_unique<State>())
+{
+    State* state = state_.get();
+    worker_ = std::thread([state, &sampler, observers, n_paths, &rng, publish_every] {
+        OnlineStatistics stats;
+        try 
+        {
+            MonteCarloEngine engine(sampler);
+            for (EngineObserver* observer : observers)
+                engine.attach(*observer);
+            const std::size_t block_size = MonteCarloEngine::block_size;
+            std::vector<double> scratch(std::min(n_paths, block_size));
+            MonteCarloEngine::BlockScratch buffers = engine.block_scratch(scratch.size());
+
+            std::size_t next_publish = publish_every;
+            std::size_t done = 0;
+            while (done < n_paths && !state->cancel.load(std::memory_order_relaxed))
+            {
+                std::size_t n = std::min(block_size, n_paths - done);
+                const double* Z = rng.next_block(scratch.data(), n);
+                engine.sample_block(Z, done, n, stats, buffers);
+                done += n;
+
+                if (done >= next_publish && done < n_paths)
+                {
+                    state->publish(stats, false);
+                    next_publish = done + publish_every;
+                }
+            }
+        }
+        catch (...)
+        {
+            // Kept for get(); the run still finishes so waiters see it end
+            state->error = std::current_exception();
+        }
+        state->result = stats;
+        state->publish(stats, true);
+    });
+}
+
+AsyncRun::~AsyncRun()
+{
+    if (worker_.joinable())
+    {
+        cancel();
+        worker_.join();
+    }
+}
+
+PricingSnapshot AsyncRun::snapshot() const
+{
+    const State& s = *state_;
+    PricingSnapshot snap;
+    std::size_t before, after;
+    do 
+    {
+        before = s.sequence.load(std::memory_order_acquire);
+        snap.paths_done = s.paths_done.load(std::memory_order_relaxed);
+        snap.mean = s.mean.load(std::memory_order_relaxed);
+        snap.standard_error = s.standard_error.load(std::memory_order_relaxed);
+        snap.finished = s.finished.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = s.sequence.load(std::memory_order_relaxed);
+    } 
+    while (before != after || (before & 1));
+    return snap;
+}
+
+void AsyncRun::cancel()
+{
+    state_->cancel.store(true, std::memory_order_relaxed);
+}
+
+bool AsyncRun::cancelled() const
+{
+    return state_->cancel.load(std::memory_order_relaxed);
+}
+
+bool AsyncRun::done() const
+{
+    return snapshot().finished;
+}
+
+OnlineStatistics AsyncRun::get()
+{
+    if (worker_.joinable())
+        worker_.join();
+    if (state_->error)
+        std::rethrow_exception(state_->error);
+    return state_->result;
+}
@@ -0,0 +1,158 @@
+#include "core/AutoStrategyPricer.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "samplers/MCSampler.hpp"
+#include "samplers/AntitheticSampler.hpp"
+#include "samplers/FusedControlSampler.hpp"
+#include "samplers/FusedAntitheticControlSampler.hpp"
+#include "analytics/CalibrateControl.hpp"
+#include <algorithm>
+#include <chrono>
+
+using clock_type = std::chrono::steady_clock;
+
+static double seconds_since(clock_type::time_point start)
+{
+    return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+static std::size_t paths_per_sample(Strategy strategy)
+{
+    return (strategy == Strategy::Antithetic 
+            || strategy == Strategy::AntitheticControl) ? 2 : 1;
+}
+
+std::string_view strategy_name(Strategy strategy)
+{
+    switch (strategy)
+    {
+        case Strategy::Plain: return "MC";
+        case Strategy::Antithetic: return "Antithetic";
+        case Strategy::Control: return "Control";
+        case Strategy::AntitheticControl: return "Anti+Control";
+    }
+    return "Unknown";
+}
+
+AutoStrategyPricer::AutoStrategyPricer(
+    const Model& model, 
+    const Option& option, 
+    std::size_t pilot_paths
+)
+: model_(model), option_(option), pilot_paths_(pilot_paths) {}
+
+AutoStrategyPricer::AutoStrategyPricer(
+    const Model& model, 
+    const Option& option, 
+    const Option& control, 
+    double control_mean, 
+    std::size_t pilot_paths
+)
+: model_(model), option_(option), control_(&control), 
+control_mean_(control_mean), pilot_paths_(pilot_paths) {}
+
+std::unique_ptr<PathSampler> AutoStrategyPricer::make_sampler(
+    Strategy strategy, 
+    double beta
+) const
+{
+    switch (strategy)
+    {
+        case Strategy::Antithetic: 
+            return std::make_unique<AntitheticSampler>(model_, option_);
+        case Strategy::Control: 
+            return std::make_unique<FusedControlSampler>(
+                model_, option_, *control_, control_mean_, beta);
+        case Strategy::AntitheticControl: 
+            return std::make_unique<FusedAntitheticControlSampler>(
+                model_, option_, *control_, control_mean_, beta);
+        default: 
+            return std::make_unique<MCSampler>(model_, option_);
+    }
+}
+
+AutoPricingResult AutoStrategyPricer::select(NormalSource& rng) const
+{
+    AutoPricingResult result{Strategy::Plain, {}, 0.0, 1.0, 0, {}};
+
+    std::vector<Strategy> candidates{Strategy::Plain, Strategy::Antithetic};
+    if (control_)
+    {
+        MCSampler target(model_, option_); 
+        MCSampler control(model_, *control_); 
+        std::size_t calibration_paths = 0;
+        result.beta = calibrate_beta(
+            target, control, rng, pilot_paths_, 1000, 0.01, &calibration_paths);
+        result.pilot_paths += calibration_paths;
+        candidates.push_back(Strategy::Control);
+        candidates.push_back(Strategy::AntitheticControl);
+    }
+
+    // Equal path budgets per pilot, so antithetic runs half as many samples
+    for (Strategy strategy : candidates)
+    {
+        std::unique_ptr<PathSampler> sampler = make_sampler(strategy, result.beta);
+        MonteCarloEngine engine(*sampler); 
+        std::size_t per_sample = paths_per_sample(strategy);
+        std::size_t n_samples = std::max<std::size_t>(pilot_paths_ / per_sample, 2);
+
+        auto start = clock_type::now();
+        OnlineStatistics pilot = engine.run(n_samples, rng); 
+        double elapsed = seconds_since(start);
+
+        result.pilots.push_back({
+            strategy, 
+            pilot.variance(), 
+            elapsed / static_cast<double>(n_samples), 
+            per_sample
+        });
+        result.pilot_paths += n_samples * per_sample;
+    }
+
+    // A zero-variance pilot (e.g. a constant payoff) ranks as infinitely efficient
+    const StrategyPilot* best = &result.pilots.front();
+    for (const StrategyPilot& pilot : result.pilots)
+        if (pilot.efficiency() > best->efficiency())
+            best = &pilot;
+
+    // When plain MC already has no variance there is nothing to gain, and 
+    // the ratio of two infinite efficiencies would be NaN
+    const StrategyPilot& plain = result.pilots.front();
+    result.strategy = best->strategy;
+    result.expected_speedup = plain.variance > 0.0 
+                              ? best->efficiency() / plain.efficiency() : 1.0;
+    return result;
+}
+
+AutoPricingResult AutoStrategyPricer::run(std::size_t n_paths, NormalSource& rng) const
+{
+    AutoPricingResult result = select(rng);
+    std::size_t remaining = n_paths > result.pilot_paths ? n_paths - result.pilot_paths : 0;
+    std::size_t n_samples = remaining / paths_per_sample(result.strategy);
+
+    std::unique_ptr<PathSampler> sampler = make_sampler(result.strategy, result.beta);
+    MonteCarloEngine engine(*sampler); 
+    result.stats = engine.run(n_samples, rng);
+    return result;
+}
+
+AutoPricingResult AutoStrategyPricer::run_for(double seconds, NormalSource& rng) const
+{
+    auto start = clock_type::now();
+    AutoPricingResult result = select(rng);
+
+    std::unique_ptr<PathSampler> sampler = make_sampler(result.strategy, result.beta);
+    MonteCarloEngine engine(*sampler); 
+
+    // Size chunks from the pilot cost so the deadline is checked ~100 times
+    double cost = 0.0; 
+    for (const StrategyPilot& pilot : result.pilots)
+        if (pilot.strategy == result.strategy)
+            cost = pilot.seconds_per_sample;
+    std::size_t chunk = MonteCarloEngine::block_size;
+    if (cost > 0.0)
+        chunk = std::max(chunk, static_cast<std::size_t>(seconds / (100 * cost)));
+
+    while (seconds_since(start) < seconds)
+        result.stats.merge(engine.run(chunk, rng));
+    return result;
+}
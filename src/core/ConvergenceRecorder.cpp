@@ -0,0 +1,153 @@
+#include "core/ConvergenceRecorder.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/RandomEngine.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+std::vector<std::size_t> geometric_checkpoints(
+    std::size_t first, 
+    std::size_t last, 
+    std::size_t steps_per_decade
+)
+{
+    if (first == 0 || last < first || steps_per_decade == 0)
+        throw std::invalid_argument("invalid checkpoint schedule");
+
+    std::vector<std::size_t> checkpoints; 
+    double step = std::pow(10.0, 1.0 / static_cast<double>(steps_per_decade));
+    for (std::size_t k = 0; ; ++k)
+    {
+        auto n = static_cast<std::size_t>(
+            std::llround(static_cast<double>(first) * std::pow(step, static_cast<double>(k))));
+        if (n >= last)
+            break; 
+        if (checkpoints.empty() || n > checkpoints.back())
+            checkpoints.push_back(n);
+    }
+    checkpoints.push_back(last);
+    return checkpoints;
+}
+
+ConvergenceRecorder::ConvergenceRecorder(std::vector<std::size_t> checkpoints)
+: checkpoints_(std::move(checkpoints))
+{
+    // A repeated count would never get its own snapshot
+    if (std::adjacent_find(checkpoints_.begin(), checkpoints_.end(), 
+            std::greater_equal<std::size_t>()) != checkpoints_.end())
+        throw std::invalid_argument("checkpoints must be strictly increasing");
+    snapshots_.reserve(checkpoints_.size());
+}
+
+void ConvergenceRecorder::observe(const PathBlock& block)
+{
+    // Same adds in the same order as the engine, so snapshots match it exactly
+    for (std::size_t i = 0; i < block.size; ++i)
+    {
+        stats_.add(block.estimates[i]);
+        while (snapshots_.size() < checkpoints_.size() 
+               && stats_.count() == checkpoints_[snapshots_.size()])
+            snapshots_.push_back(stats_);
+    }
+}
+
+std::vector<std::vector<OnlineStatistics>> record_convergence(
+    const PathSampler& sampler, 
+    const std::vector<std::size_t>& checkpoints, 
+    const std::vector<unsigned int>& seeds
+)
+{
+    std::vector<std::vector<OnlineStatistics>> runs(seeds.size());
+    if (checkpoints.empty())
+        return runs;
+
+    auto record = [&](std::size_t s)
+    {
+        MonteCarloEngine engine(sampler); 
+        ConvergenceRecorder recorder(checkpoints); 
+        engine.attach(recorder); 
+        RandomEngine rng(seeds[s]);
+        engine.run(checkpoints.back(), rng);
+        runs[s] = recorder.snapshots();
+    };
+
+    std::vector<std::thread> threads; 
+    for (std::size_t s = 1; s < seeds.size(); ++s)
+        threads.emplace_back(record, s);
+    if (!seeds.empty())
+        record(0);
+    for (std::thread& thread : threads)
+        thread.join();
+    return runs;
+}
+
+ConvergenceTable::ConvergenceTable(std::vector<std::size_t> paths)
+: paths_(std::move(paths)) {}
+
+void ConvergenceTable::add_column(
+    const std::string& name, 
+    const std::vector<OnlineStatistics>& snapshots, 
+    double scale
+)
+{
+    std::vector<double> values; 
+    for (const OnlineStatistics& stats : snapshots)
+        values.push_back(scale * stats.standard_error());
+    add_values(name, std::move(values));
+}
+
+void ConvergenceTable::add_band(
+    const std::string& name, 
+    const std::vector<std::vector<OnlineStatistics>>& runs, 
+    double scale
+)
+{
+    std::vector<double> mean(paths_.size()), low(paths_.size()), high(paths_.size());
+    for (std::size_t i = 0; i < paths_.size(); ++i)
+    {
+        OnlineStatistics across;
+        low[i] = high[i] = scale * runs.at(0).at(i).standard_error();
+        for (const std::vector<OnlineStatistics>& run : runs)
+        {
+            double se = scale * run.at(i).standard_error(); 
+            across.add(se); 
+            low[i] = std::min(low[i], se); 
+            high[i] = std::max(high[i], se);
+        }
+        mean[i] = across.mean();
+    }
+    add_values(name, std::move(mean)); 
+    add_values(name + "_lo", std::move(low)); 
+    add_values(name + "_hi", std::move(high));
+}
+
+void ConvergenceTable::add_values(const std::string& name, std::vector<double> values)
+{
+    if (values.size() != paths_.size())
+        throw std::invalid_argument("column " + name + " does not cover every row");
+    columns_.emplace_back(name, std::move(values));
+}
+
+bool ConvergenceTable::write_csv(const std::string& path) const
+{
+    std::ofstream csv(path); 
+    if (!csv.is_open())
+        return false;
+
+    csv << "paths";
+    for (const auto& column : columns_)
+        csv << "," << column.first;
+    csv << "\n";
+
+    for (std::size_t i = 0; i < paths_.size(); ++i)
+    {
+        csv << paths_[i];
+        for (const auto& column : columns_)
+            csv << "," << column.second[i];
+        csv << "\n";
+    }
+    return static_cast<bool>(csv);
+}
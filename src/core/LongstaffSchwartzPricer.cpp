@@ -0,0 +1,178 @@
+#include "core/LongstaffSchwartzPricer.hpp"
+#include "core/OnlineStatistics.hpp"
+#include "core/StreamRandomEngine.hpp"
+#include <cmath>
+#include <limits>
+#include <utility>
+
+/// Solves the 3x3 system A x = b by Gaussian elimination with partial pivoting.
+static bool solve3(double A[3][3], double b[3], std::array<double, 3>& x)
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        int pivot = c; 
+        for (int r = c + 1; r < 3; ++r)
+            if (std::abs(A[r][c]) > std::abs(A[pivot][c]))
+                pivot = r;
+        if (std::abs(A[pivot][c]) < 1e-12)
+            return false;
+        std::swap(A[c], A[pivot]);
+        std::swap(b[c], b[pivot]);
+
+        for (int r = c + 1; r < 3; ++r)
+        {
+            double f = A[r][c] / A[c][c];
+            for (int k = c; k < 3; ++k)
+                A[r][k] -= f * A[c][k];
+            b[r] -= f * b[c];
+        }
+    }
+    for (int r = 2; r >= 0; --r)
+    {
+        double sum = b[r];
+        for (int k = r + 1; k < 3; ++k)
+            sum -= A[r][k] * x[k];
+        x[r] = sum / A[r][r];
+    }
+    return true;
+}
+
+LongstaffSchwartzPricer::LongstaffSchwartzPricer(
+    const Model& model, 
+    const BermudanOption& option, 
+    const Discount& discount
+)
+: model_(model), option_(option), discount_(discount) {}
+
+LsmResult LongstaffSchwartzPricer::price(
+    std::size_t n_regression_paths, 
+    std::size_t n_pricing_paths, 
+    std::uint64_t regression_seed, 
+    std::uint64_t pricing_seed
+) const
+{
+    const std::vector<double>& dates = option_.exercise_dates();
+    const std::size_t m = dates.size();
+    const std::size_t n = n_regression_paths;
+    const double inv_K = 1.0 / option_.strike();
+    const double never = std::numeric_limits<double>::infinity();
+
+    LsmResult result; 
+    result.coefficients.assign(m, {never, 0.0, 0.0});
+
+// Backward induction ----------------------------------------------------------
+    // Date k of path p uses draw k * n + p, so each date is one seek + fill
+    std::vector<double> W(n);
+    std::vector<double> S(n);
+    std::vector<double> cash(n);    // discounted to time 0
+    StreamRandomEngine rng(regression_seed);
+
+    double t = dates[m - 1];
+    double df = discount_(t);
+    rng.seek((m - 1) * n);
+    rng.fill(W.data(), n);
+    for (std::size_t p = 0; p < n; ++p)
+    {
+        cash[p] = df * option_.payoff(model_.simulate(t, W[p]));
+        W[p] *= std::sqrt(t);
+    }
+
+    for (std::size_t k = m - 1; k-- > 0; )
+    {
+        // Reverse Brownian bridge from W(t_next) to W(t)
+        double t_next = t; 
+        t = dates[k];
+        df = discount_(t);
+        double shrink = t / t_next; 
+        double bridge_sd = std::sqrt(t * (t_next - t) / t_next);
+        double inv_sqrt_t = 1.0 / std::sqrt(t);
+
+        rng.seek(k * n);
+        rng.fill(S.data(), n);
+        for (std::size_t p = 0; p < n; ++p)
+        {
+            W[p] = shrink * W[p] + bridge_sd * S[p];
+            S[p] = model_.simulate(t, W[p] * inv_sqrt_t);
+        }
+
+        // Normal equations over in-the-money paths, accumulated in one pass
+        double A[3][3] = {};
+        double b[3] = {};
+        for (std::size_t p = 0; p < n; ++p)
+        {
+            if (option_.payoff(S[p]) <= 0.0)
+                continue;
+            double x = S[p] * inv_K;
+            double phi[3] = {1.0, x, x * x};
+            double y = cash[p] / df;
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                    A[i][j] += phi[i] * phi[j];
+                b[i] += phi[i] * y;
+            }
+        }
+
+        std::array<double, 3> beta; 
+        if (!solve3(A, b, beta))
+            continue;   // too few in-the-money paths: never exercise here
+        result.coefficients[k] = beta;
+
+        for (std::size_t p = 0; p < n; ++p)
+        {
+            double exercise = option_.payoff(S[p]);
+            double x = S[p] * inv_K;
+            if (exercise > 0.0 && exercise >= beta[0] + x * (beta[1] + x * beta[2]))
+                cash[p] = df * exercise;
+        }
+    }
+
+    OnlineStatistics in_sample; 
+    for (double c : cash)
+        in_sample.add(c);
+    result.in_sample_price = in_sample.mean();
+    result.working_bytes = 3 * n * sizeof(double) 
+                           + m * sizeof(std::array<double, 3>);
+
+// Forward pass on independent draws --------------------------------------------
+    std::vector<double> discounts(m);
+    std::vector<double> sqrt_dt(m);
+    for (std::size_t k = 0; k < m; ++k)
+    {
+        discounts[k] = discount_(dates[k]);
+        sqrt_dt[k] = std::sqrt(dates[k] - (k ? dates[k - 1] : 0.0));
+    }
+
+    StreamRandomEngine pricing_rng(pricing_seed);
+    OnlineStatistics stats;
+    for (std::size_t p = 0; p < n_pricing_paths; ++p)
+    {
+        pricing_rng.seek(p * m);
+        double w = 0.0; 
+        double value = 0.0;
+        for (std::size_t k = 0; k < m; ++k)
+        {
+            w += sqrt_dt[k] * pricing_rng.normal();
+            double ST = model_.simulate(dates[k], w / std::sqrt(dates[k]));
+            double exercise = option_.payoff(ST);
+            if (k + 1 == m)
+            {
+                value = discounts[k] * exercise;
+                break;
+            }
+
+            const std::array<double, 3>& beta = result.coefficients[k];
+            double x = ST * inv_K;
+            if (exercise > 0.0 && exercise >= beta[0] + x * (beta[1] + x * beta[2]))
+            {
+                value = discounts[k] * exercise;
+                break;
+            }
+        }
+        stats.add(value);
+    }
+
+    result.price = stats.mean();
+    result.standard_error = stats.standard_error();
+    return result;
+}
@@ -1,20 +1,161 @@
 #include "core/MonteCarloEngine.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 
 MonteCarloEngine::MonteCarloEngine(const PathSampler& sampler)
 : sampler_(sampler) {}
 
+void MonteCarloEngine::attach(EngineObserver& observer)
+{
+    observers_.push_back(&observer);
+}
+
+void MonteCarloEngine::detach(EngineObserver& observer)
+{
+    observers_.erase(
+        std::remove(observers_.begin(), observers_.end(), &observer), 
+        observers_.end()
+    );
+}
+
 OnlineStatistics MonteCarloEngine::run(
     std::size_t n_paths,
-    RandomEngine& rng
+    NormalSource& rng
 ) const
 {
     OnlineStatistics stats; 
+    std::vector<double> scratch(std::min(n_paths, block_size));
+    BlockScratch buffers = block_scratch(scratch.size());
 
-    for (std::size_t i = 0; i < n_paths; ++i) 
+    for (std::size_t done = 0; done < n_paths; ) 
     {  
-        double Z = rng.normal();
-        double estimate = sampler_.sample(Z);
-        stats.add(estimate);
+        std::size_t n = std::min(block_size, n_paths - done);
+        const double* Z = rng.next_block(scratch.data(), n);
+        sample_block(Z, done, n, stats, buffers);
+        done += n;
     }
     return stats;
+}
+
+MomentMatchedResult MonteCarloEngine::run_moment_matched(
+    std::size_t n_paths, 
+    NormalSource& rng, 
+    std::size_t n_blocks
+) const
+{
+    if (n_blocks < 2 || n_paths < 2 * n_blocks)
+        throw std::invalid_argument("moment matching needs at least 2 blocks of 2 paths");
+
+    std::vector<double> block_means(n_blocks), block_sizes(n_blocks);
+    std::vector<double> Z(n_paths / n_blocks + 1);
+    BlockScratch buffers = block_scratch(Z.size());
+    std::size_t first_path = 0;
+
+    for (std::size_t b = 0; b < n_blocks; ++b)
+    {
+        // The first n_paths % n_blocks blocks take one extra path
+        std::size_t n = n_paths / n_blocks + (b < n_paths % n_blocks ? 1 : 0); 
+        rng.fill(Z.data(), n);
+
+        OnlineStatistics moments; 
+        for (std::size_t i = 0; i < n; ++i)
+            moments.add(Z[i]);
+        double mean = moments.mean(); 
+        double scale = 1.0 / std::sqrt(moments.variance());
+        for (std::size_t i = 0; i < n; ++i)
+            Z[i] = (Z[i] - mean) * scale;
+
+        OnlineStatistics block; 
+        sample_block(Z.data(), first_path, n, block, buffers);
+        block_means[b] = block.mean();
+        block_sizes[b] = static_cast<double>(n);
+        first_path += n;
+    }
+
+    // A block mean has variance sigma^2 / n_b, so sigma^2 is estimated from 
+    // size-weighted squared deviations; equal blocks give the usual 
+    // standard error of the replications
+    double mean = 0.0;
+    for (std::size_t b = 0; b < n_blocks; ++b)
+        mean += block_sizes[b] * block_means[b];
+    mean /= static_cast<double>(n_paths);
+
+    double sum_sq = 0.0;
+    for (std::size_t b = 0; b < n_blocks; ++b)
+        sum_sq += block_sizes[b] * (block_means[b] - mean) * (block_means[b] - mean);
+    double sigma2 = sum_sq / static_cast<double>(n_blocks - 1);
+
+    return {mean, std::sqrt(sigma2 / static_cast<double>(n_paths)), n_paths, n_blocks};
+}
+
+AsyncRun MonteCarloEngine::run_async(
+    std::size_t n_paths, 
+    NormalSource& rng, 
+    std::size_t publish_every
+) const
+{
+    return AsyncRun(sampler_, observers_, n_paths, rng, publish_every);
+}
+
+void MonteCarloEngine::accumulate(
+    const double* Z, 
+    std::size_t n, 
+    OnlineStatistics& stats
+) const
+{
+    for (std::size_t i = 0; i < n; ++i)
+        stats.add(sampler_.sample(Z[i]));
+}
+
+MonteCarloEngine::BlockScratch MonteCarloEngine::block_scratch(std::size_t n) const
+{
+    BlockScratch scratch; 
+    if (observers_.empty())
+        return scratch;
+
+    scratch.estimates.resize(n);
+    bool records = std::any_of(observers_.begin(), observers_.end(), 
+        [](const EngineObserver* o) { return o->wants_records(); });
+    if (records)
+        scratch.records.resize(n);
+    return scratch;
+}
+
+void MonteCarloEngine::sample_block(
+    const double* Z, 
+    std::size_t first_path, 
+    std::size_t n, 
+    OnlineStatistics& stats, 
+    BlockScratch& scratch
+) const
+{
+    if (observers_.empty())
+    {
+        accumulate(Z, n, stats);
+        return;
+    }
+
+    double* estimates = scratch.estimates.data();
+    PathRecord* records = scratch.records.empty() ? nullptr : scratch.records.data();
+    if (records)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            estimates[i] = sampler_.record(Z[i], records[i]);
+            stats.add(estimates[i]);
+        }
+    }
+    else 
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            estimates[i] = sampler_.sample(Z[i]);
+            stats.add(estimates[i]);
+        }
+    }
+
+    PathBlock block{first_path, n, Z, estimates, records};
+    for (EngineObserver* observer : observers_)
+        observer->observe(block);
 }
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "core/MultiAssetEngine.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+MultiAssetEngine::MultiAssetEngine(
+    const MultiAssetBlackScholesModel& model, 
+    const MultiAssetOption& option
+)
+: model_(model), option_(option) 
+{
+    // Payoffs index each path's row of terminal prices directly
+    if (option_.n_assets() > model_.n_assets())
+        throw std::invalid_argument("option reads more assets than the model simulates");
+}
+
+OnlineStatistics MultiAssetEngine::run(
+    std::size_t n_paths, 
+    NormalSource& rng
+) const
+{
+    const std::size_t d = model_.n_assets();
+    const double T = option_.maturity();
+
+    OnlineStatistics stats;
+    std::vector<double> Z(block_size * d);
+    std::vector<double> ST(block_size * d);
+
+    for (std::size_t done = 0; done < n_paths; )
+    {
+        std::size_t n = std::min(block_size, n_paths - done);
+        rng.fill(Z.data(), n * d);
+        model_.correlate(Z.data(), ST.data(), n);
+        model_.simulate_block(T, ST.data(), n);
+
+        for (std::size_t p = 0; p < n; ++p)
+            stats.add(option_.payoff(ST.data() + p * d));
+        done += n;
+    }
+    return stats;
+}
@@ -0,0 +1,13 @@
+#include "core/NormalSource.hpp"
+
+void NormalSource::fill(double* out, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = normal();
+}
+
+const double* NormalSource::next_block(double* scratch, std::size_t n)
+{
+    fill(scratch, n);
+    return scratch;
+}
@@ -0,0 +1,172 @@
+#include "core/NormalStore.hpp"
+#include "core/RandomEngine.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static_assert(sizeof(NormalStoreHeader) == 64, "header must stay 64 bytes");
+
+static constexpr char store_magic[8] = {'V', 'R', 'P', 'N', 'O', 'R', 'M', 'S'};
+
+static std::uint64_t fnv1a(std::uint64_t hash, const double* data, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::uint64_t word; 
+        std::memcpy(&word, &data[i], sizeof(word));
+        hash ^= word; 
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::uint64_t normal_store_checksum(const double* data, std::size_t n)
+{
+    return fnv1a(0xcbf29ce484222325ULL, data, n);
+}
+
+void write_normal_store(
+    const std::string& path, 
+    std::size_t count, 
+    unsigned int seed
+)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw std::runtime_error("cannot open " + path + " for writing");
+
+    NormalStoreHeader header{};
+    std::memcpy(header.magic, store_magic, sizeof(store_magic));
+    header.version = NormalStoreHeader::current_version;
+    header.byte_order = NormalStoreHeader::byte_order_mark;
+    header.seed = seed;
+    header.count = count;
+
+    // Reserve the header, stream the payload, then patch in the checksum
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    RandomEngine rng(seed);
+    std::vector<double> chunk(std::min<std::size_t>(count, 1 << 16));
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for (std::size_t done = 0; done < count; )
+    {
+        std::size_t n = std::min(chunk.size(), count - done);
+        rng.fill(chunk.data(), n);
+        hash = fnv1a(hash, chunk.data(), n);
+        out.write(
+            reinterpret_cast<const char*>(chunk.data()), 
+            static_cast<std::streamsize>(n * sizeof(double))
+        );
+        done += n;
+    }
+
+    header.checksum = hash;
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!out)
+        throw std::runtime_error("failed writing " + path);
+}
+
+MappedNormalStore::MappedNormalStore(const std::string& path, bool verify)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("cannot open " + path);
+
+    struct stat st; 
+    if (::fstat(fd, &st) != 0 
+        || static_cast<std::size_t>(st.st_size) < sizeof(NormalStoreHeader))
+    {
+        ::close(fd);
+        throw std::runtime_error(path + " is not a normal store");
+    }
+
+    mapping_size_ = static_cast<std::size_t>(st.st_size);
+    mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping_ == MAP_FAILED)
+    {
+        mapping_ = nullptr;
+        throw std::runtime_error("cannot map " + path);
+    }
+
+    NormalStoreHeader header;
+    std::memcpy(&header, mapping_, sizeof(header));
+
+    const char* error = nullptr;
+    if (std::memcmp(header.magic, store_magic, sizeof(store_magic)) != 0)
+        error = " is not a normal store";
+    else if (header.version != NormalStoreHeader::current_version)
+        error = " has an unsupported version";
+    else if (header.byte_order != NormalStoreHeader::byte_order_mark)
+        error = " was written with a different byte order";
+    else if ((mapping_size_ - sizeof(header)) % sizeof(double) != 0 
+             || header.count != (mapping_size_ - sizeof(header)) / sizeof(double))
+        error = " is truncated";
+
+    if (!error)
+    {
+        count_ = header.count;
+        seed_ = header.seed;
+        data_ = reinterpret_cast<const double*>(
+            static_cast<const char*>(mapping_) + sizeof(header)
+        );
+        ::madvise(mapping_, mapping_size_, MADV_SEQUENTIAL);
+        if (verify && normal_store_checksum(data_, count_) != header.checksum)
+            error = " failed its checksum";
+    }
+
+    if (error)
+    {
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+        throw std::runtime_error(path + error);
+    }
+}
+
+MappedNormalStore::~MappedNormalStore()
+{
+    if (mapping_)
+        ::munmap(mapping_, mapping_size_);
+}
+
+void MappedNormalStore::require(std::size_t n) const
+{
+    if (n > count_ - position_)
+        throw std::out_of_range("normal store exhausted");
+}
+
+double MappedNormalStore::normal()
+{
+    require(1);
+    return data_[position_++];
+}
+
+void MappedNormalStore::fill(double* out, std::size_t n)
+{
+    require(n);
+    std::memcpy(out, data_ + position_, n * sizeof(double));
+    position_ += n;
+}
+
+const double* MappedNormalStore::next_block(double*, std::size_t n)
+{
+    require(n);
+    const double* block = data_ + position_;
+    position_ += n;
+    return block;
+}
+
+void MappedNormalStore::seek(std::size_t index)
+{
+    if (index > count_)
+        throw std::out_of_range("seek past end of normal store");
+    position_ = index;
+}
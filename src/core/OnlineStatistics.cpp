@@ -1,5 +1,18 @@
 #include "core/OnlineStatistics.hpp"
 
+OnlineStatistics OnlineStatistics::from_moments(
+    std::size_t n, 
+    double mean, 
+    double m2
+)
+{
+    OnlineStatistics stats; 
+    stats.n_ = n; 
+    stats.mean_ = mean; 
+    stats.m2_ = m2; 
+    return stats;
+}
+
 void OnlineStatistics::add(double x) 
 {
     // Welford online mean
@@ -10,6 +23,24 @@ void OnlineStatistics::add(double x)
     m2_ += delta * delta2; 
 }
 
+void OnlineStatistics::merge(const OnlineStatistics& other)
+{
+    if (other.n_ == 0)
+        return;
+    if (n_ == 0)
+    {
+        *this = other; 
+        return;
+    }
+
+    // Pairwise update of Chan, Golub & LeVeque
+    std::size_t n = n_ + other.n_; 
+    double delta = other.mean_ - mean_; 
+    mean_ += delta * other.n_ / n; 
+    m2_ += other.m2_ + delta * delta * n_ * other.n_ / n; 
+    n_ = n;
+}
+
 double OnlineStatistics::variance() const 
 {
     return (n_ > 1) ? m2_ / (n_ - 1) : 0.0;
@@ -18,4 +49,4 @@ double OnlineStatistics::variance() const
 double OnlineStatistics::standard_error() const 
 {
     return std::sqrt(variance() / n_); 
-}
\ No newline at end of file
+}
@@ -0,0 +1,263 @@
+#include "core/PathDump.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static_assert(sizeof(PathDumpHeader) == 64, "header must stay 64 bytes");
+
+static constexpr char dump_magic[8] = {'V', 'R', 'P', 'P', 'A', 'T', 'H', 'S'};
+
+static PathDumpHeader make_header(std::size_t chunk_rows, std::size_t count)
+{
+    PathDumpHeader header{};
+    std::memcpy(header.magic, dump_magic, sizeof(dump_magic));
+    header.version = PathDumpHeader::current_version;
+    header.byte_order = PathDumpHeader::byte_order_mark;
+    header.columns = PathDumpHeader::column_count;
+    header.chunk_rows = static_cast<std::uint32_t>(chunk_rows);
+    header.count = count;
+    return header;
+}
+
+PathDumpWriter::PathDumpWriter(
+    const std::string& path, 
+    const PathSampler& sampler, 
+    std::size_t chunk_rows, 
+    std::size_t max_pending
+)
+: path_(path), 
+  chunk_rows_(chunk_rows), 
+  max_pending_(std::max<std::size_t>(1, max_pending))
+{
+    if (chunk_rows_ == 0 || chunk_rows_ > UINT32_MAX)
+        throw std::invalid_argument("invalid chunk size");
+    if (!sampler.records_paths())
+        throw std::invalid_argument("sampler does not record per-path terminal prices");
+
+    out_.open(path, std::ios::binary | std::ios::trunc);
+    if (!out_)
+        throw std::runtime_error("cannot open " + path + " for writing");
+
+    // Count is patched in by close()
+    PathDumpHeader header = make_header(chunk_rows_, 0);
+    out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    current_.reserve(PathDumpHeader::column_count * chunk_rows_);
+    writer_ = std::thread(&PathDumpWriter::write_loop, this);
+}
+
+PathDumpWriter::~PathDumpWriter()
+{
+    try 
+    {
+        close();
+    }
+    catch (...) 
+    {
+    }
+}
+
+void PathDumpWriter::observe(const PathBlock& block)
+{
+    if (!block.records)
+        throw std::logic_error("path dump received a block without records");
+
+    const std::size_t width = PathDumpHeader::column_count;
+    for (std::size_t i = 0; i < block.size; ++i)
+    {
+        const PathRecord& record = block.records[i];
+        current_.insert(current_.end(), {
+            block.Z[i], record.terminal, record.payoff, record.control
+        });
+        if (current_.size() == width * chunk_rows_)
+            submit();
+    }
+    count_ += block.size;
+}
+
+void PathDumpWriter::submit()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return pending_.size() < max_pending_ || error_; });
+    if (error_)
+    {
+        // Writer has stopped; close() reports the failure
+        current_.clear();
+        return;
+    }
+    pending_.push_back(std::move(current_));
+
+    // Reuse a buffer the writer has finished with
+    if (spare_.empty())
+        current_ = std::vector<double>();
+    else 
+    {
+        current_ = std::move(spare_.back());
+        spare_.pop_back();
+    }
+    current_.clear();
+    current_.reserve(PathDumpHeader::column_count * chunk_rows_);
+    cv_.notify_all();
+}
+
+void PathDumpWriter::write_loop()
+{
+    std::vector<double> columns(PathDumpHeader::column_count * chunk_rows_);
+    for (;;)
+    {
+        std::vector<double> rows; 
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return !pending_.empty() || finishing_; });
+            if (pending_.empty())
+                return;
+            rows = std::move(pending_.front());
+            pending_.pop_front();
+            cv_.notify_all();
+        }
+
+        try 
+        {
+            write_chunk(rows, columns);
+        }
+        catch (...) 
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error_ = std::current_exception();
+            pending_.clear();
+            cv_.notify_all();
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        spare_.push_back(std::move(rows));
+    }
+}
+
+void PathDumpWriter::write_chunk(const std::vector<double>& rows, std::vector<double>& columns)
+{
+    const std::size_t width = PathDumpHeader::column_count;
+    std::size_t n = rows.size() / width; 
+
+    // Rows as observed, columns as stored
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t c = 0; c < width; ++c)
+            columns[c * n + i] = rows[i * width + c];
+
+    out_.write(
+        reinterpret_cast<const char*>(columns.data()), 
+        static_cast<std::streamsize>(PathDumpHeader::column_count * n * sizeof(double))
+    );
+    if (!out_)
+        throw std::runtime_error("failed writing " + path_);
+}
+
+void PathDumpWriter::close()
+{
+    if (closed_)
+        return; 
+    closed_ = true;
+
+    if (!current_.empty())
+        submit();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finishing_ = true;
+        cv_.notify_all();
+    }
+    writer_.join();
+    if (error_)
+        std::rethrow_exception(error_);
+
+    PathDumpHeader header = make_header(chunk_rows_, count_);
+    out_.seekp(0);
+    out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out_.close();
+    if (!out_)
+        throw std::runtime_error("failed writing " + path_);
+}
+
+PathDumpReader::PathDumpReader(const std::string& path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("cannot open " + path);
+
+    struct stat st; 
+    if (::fstat(fd, &st) != 0 
+        || static_cast<std::size_t>(st.st_size) < sizeof(PathDumpHeader))
+    {
+        ::close(fd);
+        throw std::runtime_error(path + " is not a path dump");
+    }
+
+    mapping_size_ = static_cast<std::size_t>(st.st_size);
+    mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping_ == MAP_FAILED)
+    {
+        mapping_ = nullptr;
+        throw std::runtime_error("cannot map " + path);
+    }
+
+    PathDumpHeader header;
+    std::memcpy(&header, mapping_, sizeof(header));
+
+    const char* error = nullptr;
+    if (std::memcmp(header.magic, dump_magic, sizeof(dump_magic)) != 0)
+        error = " is not a path dump";
+    else if (header.version != PathDumpHeader::current_version)
+        error = " has an unsupported version";
+    else if (header.byte_order != PathDumpHeader::byte_order_mark)
+        error = " was written with a different byte order";
+    else if (header.columns != PathDumpHeader::column_count || header.chunk_rows == 0)
+        error = " has an unsupported layout";
+    else if ((mapping_size_ - sizeof(header)) % sizeof(double) != 0 
+             || header.count * header.columns 
+                != (mapping_size_ - sizeof(header)) / sizeof(double))
+        error = " is truncated";
+
+    if (error)
+    {
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+        throw std::runtime_error(path + error);
+    }
+
+    count_ = header.count;
+    chunk_rows_ = header.chunk_rows;
+    data_ = reinterpret_cast<const double*>(
+        static_cast<const char*>(mapping_) + sizeof(header)
+    );
+}
+
+PathDumpReader::~PathDumpReader()
+{
+    if (mapping_)
+        ::munmap(mapping_, mapping_size_);
+}
+
+std::size_t PathDumpReader::chunk_size(std::size_t chunk) const
+{
+    if (chunk >= n_chunks())
+        throw std::out_of_range("chunk index out of range");
+    return std::min(chunk_rows_, count_ - chunk * chunk_rows_);
+}
+
+const double* PathDumpReader::column(std::size_t chunk, PathColumn column) const
+{
+    std::size_t rows = chunk_size(chunk);
+    std::size_t offset = PathDumpHeader::column_count * chunk * chunk_rows_;
+    return data_ + offset + static_cast<std::size_t>(column) * rows;
+}
+
+double PathDumpReader::value(PathColumn column, std::size_t i) const
+{
+    if (i >= count_)
+        throw std::out_of_range("path index out of range");
+    return this->column(i / chunk_rows_, column)[i % chunk_rows_];
+}
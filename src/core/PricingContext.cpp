@@ -0,0 +1,73 @@
+#include "core/PricingContext.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+PricingContext::PricingContext(unsigned int seed, std::size_t pool_size)
+: rng_(seed), pool_(std::max<std::size_t>(pool_size, 1))
+{
+    rng_.fill(pool_.data(), pool_.size());
+}
+
+void PricingContext::replenish()
+{
+    rng_.fill(pool_.data(), cursor_);
+    cursor_ = 0;
+}
+
+PricingQuote PricingContext::price(const PricingRequest& request)
+{
+    if (request.n_paths < 2)
+        throw std::invalid_argument("a quote needs at least two paths");
+
+    // Request constants, computed once rather than per path
+    const double T = request.maturity;
+    const double drift = (request.rate - 0.5 * request.volatility * request.volatility) * T;
+    const double diffusion = request.volatility * std::sqrt(T);
+    const double forward = request.spot * std::exp(request.rate * T);
+    const double discount = std::exp(-request.rate * T);
+    const double K = request.strike;
+    const double sign = request.type == OptionType::Call ? 1.0 : -1.0;
+
+    // Sums of shifted values: y is centred on its mean, the forward, and x on 
+    // the forward's intrinsic value, so for deep in-the-money quotes the 
+    // variances are not left as the difference of two large sums
+    const double shift = std::max(sign * (forward - K), 0.0);
+    double sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0, syy = 0.0;
+    for (std::size_t done = 0; done < request.n_paths; )
+    {
+        if (cursor_ == pool_.size())
+            replenish();
+        std::size_t n = std::min(pool_.size() - cursor_, request.n_paths - done);
+        const double* Z = pool_.data() + cursor_;
+        cursor_ += n;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            double ST = request.spot * std::exp(drift + diffusion * Z[i]);
+            double x = std::max(sign * (ST - K), 0.0) - shift; 
+            double y = ST - forward;
+            sx += x; 
+            sy += y; 
+            sxx += x * x; 
+            sxy += x * y; 
+            syy += y * y;
+        }
+        done += n;
+    }
+
+    double n = static_cast<double>(request.n_paths);
+    double mean_x = sx / n; 
+    double mean_y = sy / n; 
+    double var_x = (sxx - sx * mean_x) / (n - 1); 
+    double var_y = (syy - sy * mean_y) / (n - 1); 
+    double cov = (sxy - sx * mean_y) / (n - 1);
+
+    double beta = var_y > 0.0 ? cov / var_y : 0.0; 
+    double estimate = shift + mean_x - beta * mean_y; 
+    double residual = std::max(var_x - beta * cov, 0.0);
+    return {
+        discount * estimate, 
+        discount * std::sqrt(residual / n), 
+        beta
+    };
+}
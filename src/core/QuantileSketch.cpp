@@ -0,0 +1,192 @@
+#include "core/QuantileSketch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+QuantileSketch::QuantileSketch(std::size_t k, std::uint64_t seed)
+: k_(k), 
+  levels_(1), 
+  min_(std::numeric_limits<double>::infinity()),
+  max_(-std::numeric_limits<double>::infinity()),
+  rng_state_(seed)
+{
+    if (k_ < 8)
+        throw std::invalid_argument("sketch size k must be at least 8");
+    update_capacity();
+}
+
+std::size_t QuantileSketch::capacity(std::size_t level) const
+{
+    // Top compactor holds k items, each level below two thirds of the next,
+    // floored at 8 so the bottom levels do not compact on every insert
+    std::size_t depth = levels_.size() - 1 - level; 
+    double cap = std::ceil(k_ * std::pow(2.0 / 3.0, static_cast<double>(depth)));
+    return std::max<std::size_t>(8, static_cast<std::size_t>(cap));
+}
+
+void QuantileSketch::update_capacity()
+{
+    capacities_.resize(levels_.size());
+    total_capacity_ = 0; 
+    for (std::size_t h = 0; h < levels_.size(); ++h)
+    {
+        capacities_[h] = capacity(h);
+        total_capacity_ += capacities_[h];
+    }
+}
+
+bool QuantileSketch::coin()
+{
+    // SplitMix64 step; only the top bit is used
+    std::uint64_t z = (rng_state_ += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return ((z ^ (z >> 31)) >> 63) != 0;
+}
+
+void QuantileSketch::add(double x)
+{
+    ++n_; 
+    min_ = std::min(min_, x);
+    max_ = std::max(max_, x);
+    levels_[0].push_back(x); 
+    if (++retained_ >= total_capacity_)
+        compress();
+}
+
+void QuantileSketch::observe(const PathBlock& block)
+{
+    for (std::size_t i = 0; i < block.size; ++i)
+        add(block.estimates[i]);
+}
+
+void QuantileSketch::compress()
+{
+    // Compact the lowest full level; one always exists once the sketch 
+    // holds as many items as its total capacity
+    for (std::size_t h = 0; h < levels_.size(); ++h)
+    {
+        if (levels_[h].size() < capacities_[h])
+            continue; 
+
+        if (h + 1 == levels_.size())
+        {
+            levels_.emplace_back();
+            update_capacity();
+        }
+
+        std::vector<double>& level = levels_[h]; 
+        std::vector<double>& next = levels_[h + 1];
+        std::sort(level.begin(), level.end());
+
+        // An odd item out stays behind so no weight is lost
+        std::size_t pairs = level.size() / 2; 
+        std::size_t offset = coin() ? 1 : 0; 
+        for (std::size_t i = 0; i < pairs; ++i)
+            next.push_back(level[2 * i + offset]);
+
+        if (level.size() % 2 == 1)
+            level.assign(1, level.back());
+        else 
+            level.clear(); 
+
+        retained_ -= pairs; 
+        return;
+    }
+}
+
+void QuantileSketch::merge(const QuantileSketch& other)
+{
+    if (other.n_ == 0)
+        return; 
+    if (other.levels_.size() > levels_.size())
+        levels_.resize(other.levels_.size());
+    for (std::size_t h = 0; h < other.levels_.size(); ++h)
+        levels_[h].insert(
+            levels_[h].end(), 
+            other.levels_[h].begin(), 
+            other.levels_[h].end()
+        );
+
+    n_ += other.n_;
+    retained_ += other.retained_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    update_capacity();
+    while (retained_ >= total_capacity_)
+        compress();
+}
+
+std::vector<QuantileSketch::Weighted> QuantileSketch::sorted_items() const
+{
+    std::vector<Weighted> items; 
+    items.reserve(retained_);
+    for (std::size_t h = 0; h < levels_.size(); ++h)
+        for (double x : levels_[h])
+            items.push_back({x, std::uint64_t(1) << h});
+    std::sort(items.begin(), items.end(), 
+        [](const Weighted& a, const Weighted& b) { return a.value < b.value; });
+    return items;
+}
+
+double QuantileSketch::quantile(double q) const
+{
+    if (n_ == 0)
+        throw std::runtime_error("quantile of an empty sketch");
+    if (!(q >= 0.0 && q <= 1.0))
+        throw std::invalid_argument("quantile level must lie in [0, 1]");
+    if (q == 0.0)
+        return min_; 
+    if (q == 1.0)
+        return max_;
+
+    double target = q * static_cast<double>(n_);
+    double cumulative = 0.0; 
+    for (const Weighted& item : sorted_items())
+    {
+        cumulative += static_cast<double>(item.weight);
+        if (cumulative >= target)
+            return item.value;
+    }
+    return max_;
+}
+
+double QuantileSketch::rank(double x) const
+{
+    if (n_ == 0)
+        throw std::runtime_error("rank in an empty sketch");
+    std::uint64_t below = 0; 
+    for (std::size_t h = 0; h < levels_.size(); ++h)
+        for (double y : levels_[h])
+            if (y <= x)
+                below += std::uint64_t(1) << h;
+    return static_cast<double>(below) / static_cast<double>(n_);
+}
+
+double QuantileSketch::value_at_risk(double alpha) const
+{
+    return -quantile(1.0 - alpha);
+}
+
+double QuantileSketch::expected_shortfall(double alpha) const
+{
+    if (n_ == 0)
+        throw std::runtime_error("expected shortfall of an empty sketch");
+    if (!(alpha >= 0.0 && alpha < 1.0))
+        throw std::invalid_argument("confidence level must lie in [0, 1)");
+
+    // Weighted mean of the lowest (1 - alpha) mass, splitting the boundary item
+    double tail = (1.0 - alpha) * static_cast<double>(n_);
+    double taken = 0.0; 
+    double sum = 0.0; 
+    for (const Weighted& item : sorted_items())
+    {
+        double w = std::min(static_cast<double>(item.weight), tail - taken);
+        sum += w * item.value; 
+        taken += w; 
+        if (taken >= tail)
+            break;
+    }
+    return -sum / taken;
+}
@@ -8,7 +8,13 @@ double RandomEngine::normal()
     return normal_(generator_); 
 }
 
+void RandomEngine::fill(double* out, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = normal_(generator_);
+}
+
 void RandomEngine::seed(unsigned int seed)
 {
     generator_.seed(seed);
-}
\ No newline at end of file
+}
@@ -0,0 +1,116 @@
+#include "core/ScenarioEngine.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "market/FlatDiscount.hpp"
+#include <algorithm>
+#include <cmath>
+
+ScenarioSurface::ScenarioSurface(
+    const ScenarioGrid& grid, 
+    double maturity, 
+    double rate
+)
+: n_spot_(grid.spot_shifts.size()), n_vol_(grid.vol_shifts.size()),
+stats_(grid.spot_shifts.size() * grid.vol_shifts.size() * grid.rate_shifts.size())
+{
+    discount_.resize(grid.rate_shifts.size());
+    for (std::size_t k = 0; k < discount_.size(); ++k)
+        FlatDiscount(rate + grid.rate_shifts[k]).evaluate(&maturity, &discount_[k], 1);
+}
+
+std::size_t ScenarioSurface::index(
+    std::size_t spot, 
+    std::size_t vol, 
+    std::size_t rate
+) const
+{
+    return (rate * n_vol_ + vol) * n_spot_ + spot;
+}
+
+double ScenarioSurface::price(
+    std::size_t spot, 
+    std::size_t vol, 
+    std::size_t rate
+) const
+{
+    return discount_[rate] * stats(spot, vol, rate).mean();
+}
+
+double ScenarioSurface::standard_error(
+    std::size_t spot, 
+    std::size_t vol, 
+    std::size_t rate
+) const
+{
+    return discount_[rate] * stats(spot, vol, rate).standard_error();
+}
+
+OnlineStatistics& ScenarioSurface::stats(
+    std::size_t spot, 
+    std::size_t vol, 
+    std::size_t rate
+)
+{
+    return stats_[index(spot, vol, rate)];
+}
+
+const OnlineStatistics& ScenarioSurface::stats(
+    std::size_t spot, 
+    std::size_t vol, 
+    std::size_t rate
+) const
+{
+    return stats_[index(spot, vol, rate)];
+}
+
+ScenarioEngine::ScenarioEngine(
+    const BlackScholesModel& model, 
+    const Option& option, 
+    ScenarioGrid grid
+)
+: model_(model), option_(option), grid_(std::move(grid)) {}
+
+ScenarioSurface ScenarioEngine::run(
+    std::size_t n_paths, 
+    NormalSource& rng
+) const
+{
+    const double T = option_.maturity();
+    const double sqrt_T = std::sqrt(T);
+    ScenarioSurface surface(grid_, T, model_.rate());
+
+    const std::size_t block_size = MonteCarloEngine::block_size;
+    std::vector<double> scratch(std::min(n_paths, block_size));
+    std::vector<double> growth(scratch.size());
+
+    for (std::size_t done = 0; done < n_paths; )
+    {
+        std::size_t n = std::min(block_size, n_paths - done);
+        const double* Z = rng.next_block(scratch.data(), n);
+
+        for (std::size_t j = 0; j < grid_.vol_shifts.size(); ++j)
+        {
+            // The only Z-dependent term, shared by all spot and rate shifts
+            double vol = model_.volatility() + grid_.vol_shifts[j];
+            double diffusion = vol * sqrt_T;
+            for (std::size_t i = 0; i < n; ++i)
+                growth[i] = std::exp(diffusion * Z[i]);
+
+            for (std::size_t k = 0; k < grid_.rate_shifts.size(); ++k)
+            {
+                double rate = model_.rate() + grid_.rate_shifts[k];
+                double drift = std::exp((rate - 0.5 * vol * vol) * T);
+
+                for (std::size_t s = 0; s < grid_.spot_shifts.size(); ++s)
+                {
+                    double scale = model_.spot() 
+                                   * (1.0 + grid_.spot_shifts[s]) * drift;
+                    OnlineStatistics& stats = surface.stats(s, j, k);
+                    for (std::size_t i = 0; i < n; ++i)
+                        stats.add(option_.payoff(scale * growth[i]));
+                }
+            }
+        }
+        done += n;
+    }
+    return surface;
+}
@@ -0,0 +1,50 @@
+#include "core/ScriptedEngine.hpp"
+#include <algorithm>
+#include <vector>
+
+ScriptedEngine::ScriptedEngine(
+    const BlackScholesModel& model, 
+    const ScriptedOption& option
+)
+: model_(model), option_(option) {}
+
+OnlineStatistics ScriptedEngine::run(
+    std::size_t n_paths, 
+    NormalSource& rng
+) const
+{
+    const std::vector<double>& dates = option_.dates();
+    const std::size_t d = dates.size();
+
+    OnlineStatistics stats;
+    std::vector<double> S(block_size * d);
+    std::vector<const double*> columns(d);
+    std::vector<double> payoff(block_size);
+    std::vector<double> scratch(option_.script().scratch_size(block_size));
+
+    for (std::size_t done = 0; done < n_paths; )
+    {
+        std::size_t n = std::min(block_size, n_paths - done);
+
+        // Column k holds the prices at dates[k], stepped from column k - 1
+        for (std::size_t k = 0; k < d; ++k)
+        {
+            double* column = S.data() + k * n;
+            rng.fill(column, n);
+            double dt = dates[k] - (k == 0 ? 0.0 : dates[k - 1]);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                double from = k == 0 ? model_.spot() : column[i - n];
+                column[i] = BlackScholesModel::simulate(
+                    from, model_.rate(), model_.volatility(), dt, column[i]);
+            }
+            columns[k] = column;
+        }
+
+        option_.payoff_block(columns.data(), n, payoff.data(), scratch.data());
+        for (std::size_t i = 0; i < n; ++i)
+            stats.add(payoff[i]);
+        done += n;
+    }
+    return stats;
+}
@@ -0,0 +1,204 @@
+#include "core/ShardedRun.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/StreamRandomEngine.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <stdexcept>
+
+static constexpr char shard_magic[8] = {'V', 'R', 'P', 'S', 'H', 'A', 'R', 'D'};
+static constexpr std::uint32_t shard_version = 2;
+
+std::uint64_t run_identity(
+    std::string_view sampler, 
+    double spot, 
+    double strike, 
+    double rate, 
+    double volatility, 
+    double maturity, 
+    OptionType type
+)
+{
+    // 64-bit FNV-1a over the sampler name and the bytes of each input
+    std::uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const void* data, std::size_t size)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i)
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+    };
+
+    mix(sampler.data(), sampler.size());
+    for (double input : {spot, strike, rate, volatility, maturity})
+        mix(&input, sizeof(input));
+    auto call = static_cast<std::uint8_t>(type == OptionType::Call);
+    mix(&call, sizeof(call));
+    return hash;
+}
+
+std::uint64_t ShardPlan::n_blocks() const
+{
+    return (n_paths + block_size - 1) / block_size;
+}
+
+std::uint64_t ShardPlan::first_block(std::uint64_t shard) const
+{
+    // Spread the remainder over the first shards
+    std::uint64_t base = n_blocks() / n_shards; 
+    std::uint64_t extra = n_blocks() % n_shards;
+    return shard * base + std::min(shard, extra);
+}
+
+std::uint64_t ShardPlan::end_block(std::uint64_t shard) const
+{
+    return first_block(shard + 1);
+}
+
+ShardResult run_shard(
+    const PathSampler& sampler, 
+    std::uint64_t seed, 
+    const ShardPlan& plan, 
+    std::uint64_t shard, 
+    double discount, 
+    std::uint64_t identity
+)
+{
+    if (plan.n_shards == 0 || shard >= plan.n_shards || plan.block_size == 0)
+        throw std::invalid_argument("invalid shard");
+
+    ShardResult result{seed, identity, plan, shard, discount, {}};
+    MonteCarloEngine engine(sampler);
+    StreamRandomEngine rng(seed);
+
+    for (std::uint64_t b = plan.first_block(shard); b < plan.end_block(shard); ++b)
+    {
+        std::uint64_t first_path = b * plan.block_size; 
+        std::uint64_t n = std::min(plan.block_size, plan.n_paths - first_path);
+        rng.seek(first_path);
+        result.blocks.push_back(engine.run(n, rng));
+    }
+    return result;
+}
+
+template <class T>
+static void put(std::ofstream& out, const T& value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+static T get(std::ifstream& in)
+{
+    T value; 
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+
+void write_shard(const std::string& path, const ShardResult& result)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw std::runtime_error("cannot open " + path + " for writing");
+
+    out.write(shard_magic, sizeof(shard_magic));
+    put(out, shard_version);
+    put(out, result.seed);
+    put(out, result.identity);
+    put(out, result.plan.n_paths);
+    put(out, result.plan.n_shards);
+    put(out, result.plan.block_size);
+    put(out, result.shard);
+    put(out, result.discount);
+    put(out, static_cast<std::uint64_t>(result.blocks.size()));
+    for (const OnlineStatistics& block : result.blocks)
+    {
+        put(out, static_cast<std::uint64_t>(block.count()));
+        put(out, block.mean());
+        put(out, block.m2());
+    }
+    if (!out)
+        throw std::runtime_error("failed writing " + path);
+}
+
+ShardResult read_shard(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        throw std::runtime_error("cannot open " + path);
+
+    char magic[sizeof(shard_magic)];
+    in.read(magic, sizeof(magic));
+    if (!in || std::memcmp(magic, shard_magic, sizeof(magic)) != 0)
+        throw std::runtime_error(path + " is not a shard file");
+    if (get<std::uint32_t>(in) != shard_version)
+        throw std::runtime_error(path + " has an unsupported version");
+
+    ShardResult result;
+    result.seed = get<std::uint64_t>(in);
+    result.identity = get<std::uint64_t>(in);
+    result.plan.n_paths = get<std::uint64_t>(in);
+    result.plan.n_shards = get<std::uint64_t>(in);
+    result.plan.block_size = get<std::uint64_t>(in);
+    result.shard = get<std::uint64_t>(in);
+    result.discount = get<double>(in);
+
+    std::uint64_t n_blocks = get<std::uint64_t>(in);
+    for (std::uint64_t b = 0; b < n_blocks && in; ++b)
+    {
+        auto n = get<std::uint64_t>(in);
+        double mean = get<double>(in);
+        double m2 = get<double>(in);
+        result.blocks.push_back(OnlineStatistics::from_moments(n, mean, m2));
+    }
+    if (!in)
+        throw std::runtime_error(path + " is truncated");
+    return result;
+}
+
+OnlineStatistics shard_statistics(const ShardResult& shard)
+{
+    OnlineStatistics total; 
+    for (const OnlineStatistics& block : shard.blocks)
+        total.merge(block);
+    return total;
+}
+
+OnlineStatistics merge_shards(const std::vector<ShardResult>& shards)
+{
+    if (shards.empty())
+        throw std::invalid_argument("no shards to merge");
+
+    const ShardResult& first = shards.front();
+    const ShardPlan& plan = first.plan;
+    std::vector<const ShardResult*> by_shard(plan.n_shards, nullptr);
+
+    for (const ShardResult& s : shards)
+    {
+        if (s.seed != first.seed 
+            || s.identity != first.identity 
+            || s.plan.n_paths != plan.n_paths 
+            || s.plan.n_shards != plan.n_shards 
+            || s.plan.block_size != plan.block_size 
+            || s.discount != first.discount)
+            throw std::invalid_argument("shards come from different runs");
+        if (s.shard >= plan.n_shards || by_shard[s.shard])
+            throw std::invalid_argument("duplicate or out of range shard");
+        if (s.blocks.size() != plan.end_block(s.shard) - plan.first_block(s.shard))
+            throw std::invalid_argument("shard has the wrong number of blocks");
+        by_shard[s.shard] = &s;
+    }
+
+    OnlineStatistics total; 
+    for (std::uint64_t k = 0; k < plan.n_shards; ++k)
+    {
+        if (!by_shard[k])
+            throw std::invalid_argument(
+                "missing shard " + std::to_string(k) 
+                + " of " + std::to_string(plan.n_shards)
+            );
+        for (const OnlineStatistics& block : by_shard[k]->blocks)
+            total.merge(block);
+    }
+    return total;
+}
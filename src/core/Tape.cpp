@@ -0,0 +1,42 @@
+#include "core/Tape.hpp"
+#include <algorithm>
+
+Tape& Tape::current()
+{
+    thread_local Tape tape; 
+    return tape;
+}
+
+Active Tape::variable(double value)
+{
+    nodes_.push_back({{0.0, 0.0}, {no_parent, no_parent}});
+    return Active(value, static_cast<std::uint32_t>(nodes_.size() - 1));
+}
+
+void Tape::propagate(const Active& output)
+{
+    adjoints_.assign(nodes_.size(), 0.0);
+    if (output.is_constant())
+        return; 
+
+    // Nodes are recorded in evaluation order, so one backward pass suffices
+    adjoints_[output.node()] = 1.0;
+    for (std::size_t i = output.node() + 1; i-- > 0; )
+    {
+        double adjoint = adjoints_[i]; 
+        if (adjoint == 0.0)
+            continue; 
+        const Node& node = nodes_[i];
+        if (node.parent[0] != no_parent)
+            adjoints_[node.parent[0]] += adjoint * node.partial[0];
+        if (node.parent[1] != no_parent)
+            adjoints_[node.parent[1]] += adjoint * node.partial[1];
+    }
+}
+
+double Tape::adjoint(const Active& x) const
+{
+    if (x.is_constant() || x.node() >= adjoints_.size())
+        return 0.0;
+    return adjoints_[x.node()];
+}
@@ -0,0 +1,285 @@
+#include "core/WorkStealingScheduler.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/StreamRandomEngine.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using clock_type = std::chrono::steady_clock;
+
+namespace 
+{
+
+struct JobState
+{
+    const PricingJob* job; 
+    std::unique_ptr<PathSampler> sampler; 
+    std::vector<OnlineStatistics> blocks; 
+    std::atomic<std::uint64_t> remaining{0};
+    OnlineStatistics result;
+};
+
+/// A job's setup when block == setup_task, otherwise one of its path blocks.
+struct Task
+{
+    static constexpr std::uint64_t setup_task = ~std::uint64_t(0);
+
+    JobState* job; 
+    std::uint64_t block; 
+};
+
+struct Worker 
+{
+    std::mutex mutex;
+    std::deque<Task> tasks;
+    double busy = 0.0;
+    std::size_t steals = 0;
+};
+
+class Batch 
+{
+public: 
+    Batch(const SchedulerConfig& config, std::vector<JobState>& jobs)
+    : config_(config), workers_(config.n_threads)
+    {
+        // Setup tasks are dealt round-robin; blocks land on whoever ran setup
+        outstanding_ = jobs.size();
+        for (std::size_t j = 0; j < jobs.size(); ++j)
+            workers_[j % workers_.size()].tasks.push_back({&jobs[j], Task::setup_task});
+    }
+
+    void work(std::size_t self)
+    {
+        pin(self);
+        Worker& me = workers_[self];
+        Task task;
+        while (running())
+        {
+            // Read before looking for work so a push in between is not missed
+            std::uint64_t generation = generation_.load(std::memory_order_acquire);
+            if (pop(me, task) || (config_.steal && steal(self, task)))
+            {
+                auto start = clock_type::now();
+                try 
+                {
+                    execute(me, task);
+                }
+                catch (...)
+                {
+                    fail(std::current_exception());
+                }
+                std::chrono::duration<double> elapsed = clock_type::now() - start;
+                me.busy += elapsed.count();
+                if (outstanding_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    wake_all();
+            }
+            else 
+                park(generation);
+        }
+    }
+
+    /// First exception thrown by a task, or null.
+    std::exception_ptr error() const { return error_; }
+
+    const std::vector<Worker>& workers() const { return workers_; }
+
+private: 
+    bool running() const
+    {
+        return outstanding_.load(std::memory_order_acquire) > 0 
+               && !failed_.load(std::memory_order_acquire);
+    }
+
+    /// Sleeps until tasks are pushed, the batch finishes or a task fails.
+    void park(std::uint64_t generation)
+    {
+        std::unique_lock<std::mutex> lock(idle_mutex_);
+        idle_.wait(lock, [&] {
+            return !running() 
+                   || generation_.load(std::memory_order_acquire) != generation;
+        });
+    }
+
+    void wake_all()
+    {
+        {
+            std::lock_guard<std::mutex> lock(idle_mutex_);
+            generation_.fetch_add(1, std::memory_order_acq_rel);
+        }
+        idle_.notify_all();
+    }
+
+    void fail(std::exception_ptr error)
+    {
+        {
+            std::lock_guard<std::mutex> lock(idle_mutex_);
+            if (!error_)
+                error_ = error;
+            failed_.store(true, std::memory_order_release);
+        }
+        idle_.notify_all();
+    }
+
+    bool pop(Worker& w, Task& task)
+    {
+        std::lock_guard<std::mutex> lock(w.mutex);
+        if (w.tasks.empty())
+            return false;
+        task = w.tasks.back();
+        w.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(std::size_t self, Task& task)
+    {
+        const std::size_t n = workers_.size();
+        for (std::size_t k = 1; k < n; ++k)
+        {
+            Worker& victim = workers_[(self + k) % n];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty())
+            {
+                task = victim.tasks.front();
+                victim.tasks.pop_front();
+                ++workers_[self].steals;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void execute(Worker& me, const Task& task)
+    {
+        JobState& state = *task.job;
+        const std::uint64_t block_size = config_.block_size;
+
+        if (task.block == Task::setup_task)
+        {
+            state.sampler = state.job->make_sampler();
+            std::uint64_t n_blocks = (state.job->n_paths + block_size - 1) / block_size;
+            state.blocks.resize(n_blocks);
+            state.remaining.store(n_blocks, std::memory_order_release);
+
+            outstanding_.fetch_add(n_blocks, std::memory_order_acq_rel);
+            {
+                std::lock_guard<std::mutex> lock(me.mutex);
+                // Pushed last-to-first so the owner pops blocks in path order
+                for (std::uint64_t b = n_blocks; b-- > 0; )
+                    me.tasks.push_back({&state, b});
+            }
+            if (n_blocks > 0)
+                wake_all();
+            return;
+        }
+
+        std::uint64_t first = task.block * block_size;
+        std::uint64_t n = std::min(block_size, state.job->n_paths - first);
+        StreamRandomEngine rng(state.job->seed);
+        rng.seek(first);
+        state.blocks[task.block] = MonteCarloEngine(*state.sampler).run(n, rng);
+
+        // The last block to finish folds the job's blocks in path order
+        if (state.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            for (const OnlineStatistics& block : state.blocks)
+                state.result.merge(block);
+            state.blocks.clear();
+            state.blocks.shrink_to_fit();
+        }
+    }
+
+    void pin(std::size_t self) const
+    {
+#ifdef __linux__
+        if (!config_.pin_threads)
+            return;
+        unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+        cpu_set_t set; 
+        CPU_ZERO(&set);
+        CPU_SET(self % cpus, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+        (void)self;
+#endif
+    }
+
+    const SchedulerConfig& config_;
+    std::vector<Worker> workers_;
+    std::atomic<std::size_t> outstanding_{0};
+
+    // Idle workers park on idle_ until generation_ moves
+    std::mutex idle_mutex_;
+    std::condition_variable idle_;
+    std::atomic<std::uint64_t> generation_{0};
+    std::atomic<bool> failed_{false};
+    std::exception_ptr error_;
+};
+
+} // namespace
+
+double SchedulerReport::utilization() const
+{
+    if (busy.empty() || makespan <= 0.0)
+        return 0.0;
+    double total = std::accumulate(busy.begin(), busy.end(), 0.0);
+    return total / (busy.size() * makespan);
+}
+
+WorkStealingScheduler::WorkStealingScheduler(SchedulerConfig config)
+: config_(config)
+{
+    if (config_.n_threads == 0)
+        config_.n_threads = std::max(1u, std::thread::hardware_concurrency());
+    if (config_.block_size == 0)
+        config_.block_size = 1;
+}
+
+std::vector<OnlineStatistics> WorkStealingScheduler::run(
+    const std::vector<PricingJob>& jobs, 
+    SchedulerReport* report
+) const
+{
+    std::vector<JobState> states(jobs.size());
+    for (std::size_t j = 0; j < jobs.size(); ++j)
+        states[j].job = &jobs[j];
+
+    Batch batch(config_, states);
+    auto start = clock_type::now();
+
+    std::vector<std::thread> threads;
+    for (std::size_t k = 1; k < config_.n_threads; ++k)
+        threads.emplace_back(&Batch::work, &batch, k);
+    batch.work(0);
+    for (std::thread& t : threads)
+        t.join();
+    if (batch.error())
+        std::rethrow_exception(batch.error());
+
+    std::chrono::duration<double> makespan = clock_type::now() - start;
+    if (report)
+    {
+        report->makespan = makespan.count();
+        report->busy.clear();
+        report->steals = 0;
+        for (const Worker& w : batch.workers())
+        {
+            report->busy.push_back(w.busy);
+            report->steals += w.steals;
+        }
+    }
+
+    std::vector<OnlineStatistics> results;
+    for (const JobState& state : states)
+        results.push_back(state.result);
+    return results;
+}
@@ -1,6 +1,6 @@
 #include "samplers/MCSampler.hpp"
 #include "samplers/AntitheticSampler.hpp"
-#include "samplers/ControlSampler.hpp"
+#include "samplers/FusedControlSampler.hpp"
 #include "models/BlackScholesModel.hpp"
 #include "options/EuropeanOption.hpp"
 #include "options/NoOption.hpp"
@@ -9,11 +9,24 @@
 #include "core/RandomEngine.hpp"
 #include "analytics/BlackScholesClosedForm.hpp"
 #include "analytics/CalibrateControl.hpp"
+#include "core/ShardedRun.hpp"
 #include <iostream>
 #include <iomanip>
 #include <memory>
+#include <string>
+#include <exception>
 
-int main()
+int run_demo();
+int run_sharded(int argc, char** argv);
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+        return run_sharded(argc, argv);
+    return run_demo();
+}
+
+int run_demo()
 {
     // Parameters
     double S = 100.0;
@@ -64,16 +77,9 @@ int main()
         0.01    // error target
     );
     
-    // set up the control variate sampler
-    auto cv_target = std::make_unique<MCSampler>(model, put);
-    auto cv_control = std::make_unique<MCSampler>(model, control); 
+    // set up the control variate sampler, simulating ST once per path
     double control_mean = S / discount(T); 
-    ControlSampler cv_sampler(
-        std::move(cv_target), 
-        std::move(cv_control), 
-        control_mean, 
-        beta
-    );
+    FusedControlSampler cv_sampler(model, put, control, control_mean, beta);
     RandomEngine cv_rng(1310);
     MonteCarloEngine cv_engine(cv_sampler); 
     OnlineStatistics cv_results = cv_engine.run(n_paths, cv_rng);
@@ -108,4 +114,90 @@ int main()
     std::cout << "Beta (Control): " << beta << "\n\n";
 
     return 0;
-}
\ No newline at end of file
+}
+
+/// Prices the demo put over one shard of a deterministic path partition:
+///   option_pricer --paths N [--seed S] [--sampler mc|antithetic] 
+///                 [--shard i/n] [--block B] [--out FILE]
+/// With --out the shard statistics are written for merge_shards; 
+/// otherwise the shard is priced on its own.
+int run_sharded(int argc, char** argv)
+{
+    double S = 100.0;
+    double r = 0.05;
+    double v = 0.2;
+    double T = 1.0;
+    double K = 100.0;
+
+    ShardPlan plan{0};
+    std::uint64_t seed = 1310;
+    std::uint64_t shard = 0;
+    std::string sampler_name = "mc";
+    std::string out;
+
+    try 
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (i + 1 >= argc)
+                throw std::invalid_argument("missing value for " + arg);
+            std::string value = argv[++i];
+
+            if (arg == "--paths")
+                plan.n_paths = std::stoull(value);
+            else if (arg == "--seed")
+                seed = std::stoull(value);
+            else if (arg == "--block")
+                plan.block_size = std::stoull(value);
+            else if (arg == "--sampler")
+                sampler_name = value;
+            else if (arg == "--out")
+                out = value;
+            else if (arg == "--shard")
+            {
+                std::size_t slash = value.find('/');
+                if (slash == std::string::npos)
+                    throw std::invalid_argument("--shard expects i/n");
+                shard = std::stoull(value.substr(0, slash));
+                plan.n_shards = std::stoull(value.substr(slash + 1));
+            }
+            else 
+                throw std::invalid_argument("unknown option " + arg);
+        }
+        if (plan.n_paths == 0)
+            throw std::invalid_argument("--paths is required");
+
+        FlatDiscount discount(r); 
+        BlackScholesModel model(S, r, v); 
+        EuropeanOption put(K, T, OptionType::Put);
+
+        std::unique_ptr<PathSampler> sampler;
+        if (sampler_name == "mc")
+            sampler = std::make_unique<MCSampler>(model, put);
+        else if (sampler_name == "antithetic")
+            sampler = std::make_unique<AntitheticSampler>(model, put);
+        else 
+            throw std::invalid_argument("unknown sampler " + sampler_name);
+
+        std::uint64_t identity = run_identity(sampler_name, S, K, r, v, T, OptionType::Put);
+        ShardResult result = run_shard(*sampler, seed, plan, shard, discount(T), identity);
+        if (!out.empty())
+        {
+            write_shard(out, result);
+            return 0;
+        }
+
+        OnlineStatistics stats = shard_statistics(result);
+        std::cout << std::setprecision(17) 
+                  << "Price: " << discount(T) * stats.mean() 
+                  << " SE: " << discount(T) * stats.standard_error() 
+                  << " Paths: " << stats.count() << '\n';
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "error: " << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include "market/LogLinearDiscount.hpp"
+#include <cmath>
+
+LogLinearDiscount::LogLinearDiscount(
+    const std::vector<double>& times, 
+    const std::vector<double>& log_discount
+)
+: PiecewiseDiscount(times), 
+intercept_(n_pillars_ + 1), slope_(n_pillars_ + 1)
+{
+    double prev = 0.0;
+    for (std::size_t i = 0; i < n_pillars_; ++i)
+    {
+        slope_[i] = (log_discount[i] - prev) / (times_[i + 1] - times_[i]);
+        intercept_[i] = prev - slope_[i] * times_[i];
+        prev = log_discount[i];
+    }
+    // Flat forward extrapolation
+    slope_[n_pillars_] = slope_[n_pillars_ - 1];
+    intercept_[n_pillars_] = intercept_[n_pillars_ - 1];
+}
+
+LogLinearDiscount LogLinearDiscount::from_zero_rates(
+    const std::vector<double>& times, 
+    const std::vector<double>& rates
+)
+{
+    return LogLinearDiscount(times, log_discount_from_zero_rates(times, rates));
+}
+
+LogLinearDiscount LogLinearDiscount::from_discount_factors(
+    const std::vector<double>& times, 
+    const std::vector<double>& factors
+)
+{
+    return LogLinearDiscount(times, log_discount_from_factors(times, factors));
+}
+
+double LogLinearDiscount::operator()(double T) const
+{
+    std::size_t i = segment(T);
+    return std::exp(intercept_[i] + slope_[i] * T);
+}
+
+void LogLinearDiscount::evaluate(const double* T, double* df, std::size_t n) const
+{
+    if (n == 0) 
+        return;
+
+    std::size_t i = segment(T[0]);
+    df[0] = intercept_[i] + slope_[i] * T[0];
+    for (std::size_t k = 1; k < n; ++k)
+    {
+        i = next_segment(i, T[k - 1], T[k]);
+        df[k] = intercept_[i] + slope_[i] * T[k];
+    }
+    // Separate pass so the exponentials vectorise
+    for (std::size_t k = 0; k < n; ++k)
+        df[k] = std::exp(df[k]);
+}
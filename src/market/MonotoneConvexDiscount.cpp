@@ -0,0 +1,206 @@
+#include "market/MonotoneConvexDiscount.hpp"
+#include <algorithm>
+#include <cmath>
+
+static double square(double x) { return x * x; }
+static double cube(double x) { return x * x * x; }
+
+MonotoneConvexDiscount::MonotoneConvexDiscount(
+    const std::vector<double>& times, 
+    const std::vector<double>& log_discount
+)
+: PiecewiseDiscount(times), segments_(n_pillars_)
+{
+    const std::size_t n = n_pillars_;
+
+    // Discrete forwards over each segment
+    double prev = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        Segment& s = segments_[i];
+        s.start = times_[i];
+        s.width = times_[i + 1] - times_[i];
+        s.log_discount = prev;
+        s.forward = (prev - log_discount[i]) / s.width;
+        prev = log_discount[i];
+    }
+
+    // Instantaneous forwards at the pillars
+    std::vector<double> f(n + 1, segments_[0].forward);
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        const Segment& left = segments_[i - 1]; 
+        const Segment& right = segments_[i];
+        f[i] = (left.width * right.forward + right.width * left.forward) 
+               / (left.width + right.width);
+    }
+    if (n > 1)
+    {
+        f[0] = segments_[0].forward - 0.5 * (f[1] - segments_[0].forward);
+        f[n] = segments_[n - 1].forward 
+               - 0.5 * (f[n - 1] - segments_[n - 1].forward);
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        Segment& s = segments_[i];
+        double g0 = f[i] - s.forward; 
+        double g1 = f[i + 1] - s.forward;
+        s.g0 = g0; 
+        s.g1 = g1; 
+        s.eta = 0.0; 
+        s.A = 0.0;
+
+        if (g0 == 0.0 && g1 == 0.0)
+            s.region = Region::Flat;
+        else if ((g0 < 0.0 && -0.5 * g0 <= g1 && g1 <= -2.0 * g0) 
+                 || (g0 > 0.0 && -0.5 * g0 >= g1 && g1 >= -2.0 * g0))
+            s.region = Region::Quadratic;
+        else if ((g0 < 0.0 && g1 > -2.0 * g0) || (g0 > 0.0 && g1 < -2.0 * g0))
+        {
+            s.region = Region::FlatHead;
+            s.eta = (g1 + 2.0 * g0) / (g1 - g0);
+        }
+        else if ((g0 > 0.0 && 0.0 > g1 && g1 > -0.5 * g0) 
+                 || (g0 < 0.0 && 0.0 < g1 && g1 < -0.5 * g0))
+        {
+            s.region = Region::FlatTail;
+            s.eta = 3.0 * g1 / (g1 - g0);
+        }
+        else 
+        {
+            s.region = Region::Trough;
+            s.eta = g1 / (g1 + g0);
+            s.A = -g0 * g1 / (g0 + g1);
+        }
+    }
+
+    last_log_discount_ = log_discount[n - 1];
+    last_forward_ = f[n];
+}
+
+MonotoneConvexDiscount MonotoneConvexDiscount::from_zero_rates(
+    const std::vector<double>& times, 
+    const std::vector<double>& rates
+)
+{
+    return MonotoneConvexDiscount(
+        times, log_discount_from_zero_rates(times, rates)
+    );
+}
+
+MonotoneConvexDiscount MonotoneConvexDiscount::from_discount_factors(
+    const std::vector<double>& times, 
+    const std::vector<double>& factors
+)
+{
+    return MonotoneConvexDiscount(
+        times, log_discount_from_factors(times, factors)
+    );
+}
+
+double MonotoneConvexDiscount::integral(const Segment& s, double x)
+{
+    const double g0 = s.g0, g1 = s.g1, eta = s.eta, A = s.A;
+    switch (s.region)
+    {
+    case Region::Flat:
+        return 0.0;
+    case Region::Quadratic:
+        return g0 * (x - 2.0 * x * x + x * x * x) + g1 * (x * x * x - x * x);
+    case Region::FlatHead:
+        if (x <= eta) 
+            return g0 * x;
+        return g0 * x + (g1 - g0) * cube(x - eta) 
+                        / (3.0 * (1.0 - eta) * (1.0 - eta));
+    case Region::FlatTail:
+        if (x < eta)
+            return g1 * x + (g0 - g1) 
+                            * (cube(eta) - cube(eta - x)) 
+                            / (3.0 * eta * eta);
+        return g1 * x + (g0 - g1) * eta / 3.0;
+    case Region::Trough:
+    default:
+        if (x <= eta)
+            return A * x + (g0 - A) 
+                           * (cube(eta) - cube(eta - x)) 
+                           / (3.0 * eta * eta);
+        return A * x + (g0 - A) * eta / 3.0 
+               + (g1 - A) * cube(x - eta) 
+                 / (3.0 * (1.0 - eta) * (1.0 - eta));
+    }
+}
+
+double MonotoneConvexDiscount::correction(const Segment& s, double x)
+{
+    const double g0 = s.g0, g1 = s.g1, eta = s.eta, A = s.A;
+    switch (s.region)
+    {
+    case Region::Flat:
+        return 0.0;
+    case Region::Quadratic:
+        return g0 * (1.0 - 4.0 * x + 3.0 * x * x) + g1 * (3.0 * x * x - 2.0 * x);
+    case Region::FlatHead:
+        if (x <= eta) 
+            return g0;
+        return g0 + (g1 - g0) * square((x - eta) / (1.0 - eta));
+    case Region::FlatTail:
+        if (x < eta)
+            return g1 + (g0 - g1) * square((eta - x) / eta);
+        return g1;
+    case Region::Trough:
+    default:
+        if (x <= eta)
+            return A + (g0 - A) * square((eta - x) / eta);
+        return A + (g1 - A) * square((x - eta) / (1.0 - eta));
+    }
+}
+
+double MonotoneConvexDiscount::log_discount(std::size_t i, double T) const
+{
+    if (i == n_pillars_)
+        return last_log_discount_ - last_forward_ * (T - times_.back());
+
+    const Segment& s = segments_[i];
+    double x = (T - s.start) / s.width;
+    return s.log_discount 
+           - s.forward * (T - s.start) 
+           - s.width * integral(s, x);
+}
+
+double MonotoneConvexDiscount::operator()(double T) const
+{
+    if (T <= 0.0)
+        return 1.0;
+    return std::exp(log_discount(segment(T), T));
+}
+
+void MonotoneConvexDiscount::evaluate(
+    const double* T, 
+    double* df, 
+    std::size_t n
+) const
+{
+    if (n == 0) 
+        return;
+
+    std::size_t i = segment(T[0]);
+    df[0] = T[0] <= 0.0 ? 0.0 : log_discount(i, T[0]);
+    for (std::size_t k = 1; k < n; ++k)
+    {
+        i = next_segment(i, T[k - 1], T[k]);
+        df[k] = T[k] <= 0.0 ? 0.0 : log_discount(i, T[k]);
+    }
+    for (std::size_t k = 0; k < n; ++k)
+        df[k] = std::exp(df[k]);
+}
+
+double MonotoneConvexDiscount::forward(double T) const
+{
+    std::size_t i = segment(std::max(T, 0.0));
+    if (i == n_pillars_)
+        return last_forward_;
+
+    const Segment& s = segments_[i];
+    return s.forward + correction(s, (std::max(T, 0.0) - s.start) / s.width);
+}
@@ -0,0 +1,79 @@
+#include "market/PiecewiseDiscount.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+PiecewiseDiscount::PiecewiseDiscount(const std::vector<double>& times)
+: n_pillars_(times.size())
+{
+    if (times.empty())
+        throw std::invalid_argument("discount curve needs at least one pillar");
+
+    times_.reserve(times.size() + 1);
+    times_.push_back(0.0);
+    for (double t : times)
+    {
+        if (!(t > times_.back()))
+            throw std::invalid_argument(
+                "pillar maturities must be positive and increasing"
+            );
+        times_.push_back(t);
+    }
+
+    // Buckets no wider than the tightest pillar gap hold at most one pillar, 
+    // so a lookup scans at most one step past its bucket's segment
+    double min_gap = times_[1];
+    for (std::size_t i = 1; i < times_.size(); ++i)
+        min_gap = std::min(min_gap, times_[i] - times_[i - 1]);
+
+    double span = times_.back();
+    // Capped at 4096 unless the pillars alone need more
+    std::size_t n_buckets = std::max<std::size_t>(
+        4 * n_pillars_, 
+        std::min<std::size_t>(static_cast<std::size_t>(std::ceil(span / min_gap)), 4096)
+    );
+    inv_width_ = n_buckets / span;
+    last_bucket_ = static_cast<double>(n_buckets);
+
+    buckets_.resize(n_buckets + 1);
+    std::size_t i = 0;
+    for (std::size_t b = 0; b <= n_buckets; ++b)
+    {
+        double left = b / inv_width_;
+        while (i + 1 < n_pillars_ && times_[i + 1] <= left)
+            ++i;
+        buckets_[b] = i;
+    }
+}
+
+std::vector<double> log_discount_from_zero_rates(
+    const std::vector<double>& times, 
+    const std::vector<double>& rates
+)
+{
+    if (times.size() != rates.size())
+        throw std::invalid_argument("need one zero rate per pillar");
+
+    std::vector<double> log_discount(times.size());
+    for (std::size_t i = 0; i < times.size(); ++i)
+        log_discount[i] = -rates[i] * times[i];
+    return log_discount;
+}
+
+std::vector<double> log_discount_from_factors(
+    const std::vector<double>& times, 
+    const std::vector<double>& factors
+)
+{
+    if (times.size() != factors.size())
+        throw std::invalid_argument("need one discount factor per pillar");
+
+    std::vector<double> log_discount(factors.size());
+    for (std::size_t i = 0; i < factors.size(); ++i)
+    {
+        if (!(factors[i] > 0.0))
+            throw std::invalid_argument("discount factors must be positive");
+        log_discount[i] = std::log(factors[i]);
+    }
+    return log_discount;
+}
@@ -10,7 +10,5 @@ BlackScholesModel::BlackScholesModel(
 
 double BlackScholesModel::simulate(double t, double Z) const 
 {
-    return spot_ * std::exp(
-        (rate_ - 0.5 * vol_ * vol_) * t + vol_ * std::sqrt(t) * Z
-    );
+    return simulate<double>(spot_, rate_, vol_, t, Z);
 };
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "models/HestonModel.hpp"
+#include <algorithm>
+#include <cmath>
+
+// Switching level between the quadratic and exponential branches
+static constexpr double psi_critical = 1.5;
+
+HestonPathBlock::HestonPathBlock(std::size_t n_paths)
+: log_spot(n_paths), variance(n_paths), next_variance(n_paths), 
+z_variance(n_paths), z_spot(n_paths), psi(n_paths) {}
+
+HestonModel::HestonModel(
+    double spot, 
+    double rate, 
+    double v0, 
+    double kappa, 
+    double theta, 
+    double xi, 
+    double rho
+)
+: spot_(spot), rate_(rate), v0_(v0), kappa_(kappa), theta_(theta), 
+xi_(xi), rho_(rho) {}
+
+void HestonModel::simulate_block(
+    double t, 
+    std::size_t n_steps, 
+    NormalSource& rng, 
+    HestonPathBlock& paths
+) const
+{
+    std::fill(paths.log_spot.begin(), paths.log_spot.end(), std::log(spot_));
+    std::fill(paths.variance.begin(), paths.variance.end(), v0_);
+
+    double dt = t / n_steps;
+    for (std::size_t k = 0; k < n_steps; ++k)
+        step(dt, rng, paths);
+}
+
+void HestonModel::step(
+    double dt, 
+    NormalSource& rng, 
+    HestonPathBlock& paths
+) const
+{
+    const std::size_t n = paths.size();
+    double* x = paths.log_spot.data(); 
+    double* v = paths.variance.data(); 
+    double* v_next = paths.next_variance.data();
+    double* zv = paths.z_variance.data(); 
+    double* zs = paths.z_spot.data();
+    double* psi = paths.psi.data();
+
+    rng.fill(zv, n);
+    rng.fill(zs, n);
+
+    // Conditional moments of V(t + dt) are affine in V(t)
+    const double e = std::exp(-kappa_ * dt);
+    const double m0 = theta_ * (1.0 - e); 
+    const double s2_v = xi_ * xi_ * e * (1.0 - e) / kappa_; 
+    const double s2_0 = theta_ * xi_ * xi_ * (1.0 - e) * (1.0 - e) / (2.0 * kappa_);
+
+    // Pass 1: conditional mean and psi = s^2 / m^2 (pure arithmetic)
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double m = m0 + v[i] * e; 
+        double s2 = s2_0 + v[i] * s2_v;
+        v_next[i] = m; 
+        psi[i] = s2 / (m * m);
+    }
+
+    // Pass 2: QE draw of the next variance
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double m = v_next[i];
+        if (psi[i] <= psi_critical)
+        {
+            double inv_psi = 2.0 / psi[i];
+            double b2 = inv_psi - 1.0 + std::sqrt(inv_psi * (inv_psi - 1.0));
+            double b = std::sqrt(b2);
+            double a = m / (1.0 + b2);
+            v_next[i] = a * (b + zv[i]) * (b + zv[i]);
+        }
+        else 
+        {
+            double p = (psi[i] - 1.0) / (psi[i] + 1.0);
+            double beta = (1.0 - p) / m; 
+            double u = 0.5 * std::erfc(-zv[i] / std::sqrt(2.0));
+            v_next[i] = u <= p ? 0.0 : std::log((1.0 - p) / (1.0 - u)) / beta;
+        }
+    }
+
+    // Pass 3: log-spot update given both variance end points
+    const double k0 = (rate_ - rho_ * kappa_ * theta_ / xi_) * dt; 
+    const double k_half = 0.5 * dt * (kappa_ * rho_ / xi_ - 0.5);
+    const double k1 = k_half - rho_ / xi_; 
+    const double k2 = k_half + rho_ / xi_; 
+    const double k3 = 0.5 * dt * (1.0 - rho_ * rho_);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] += k0 + k1 * v[i] + k2 * v_next[i] 
+                + std::sqrt(k3 * (v[i] + v_next[i])) * zs[i];
+        v[i] = v_next[i];
+    }
+}
@@ -0,0 +1,132 @@
+#include "models/MultiAssetBlackScholesModel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+// Tile sizes: a tile of draws (paths x assets) plus the matching rows of L^T 
+// stay within L1/L2 for typical basket sizes
+static constexpr std::size_t path_tile = 64; 
+static constexpr std::size_t asset_tile = 64;
+
+MultiAssetBlackScholesModel::MultiAssetBlackScholesModel(
+    std::vector<double> spots, 
+    double rate, 
+    std::vector<double> volatilities, 
+    const std::vector<double>& correlation
+)
+: spots_(std::move(spots)), rate_(rate), vols_(std::move(volatilities))
+{
+    const std::size_t d = spots_.size();
+    if (vols_.size() != d || correlation.size() != d * d)
+        throw std::invalid_argument("model inputs must agree on the asset count");
+
+    log_drift_.resize(d);
+    for (std::size_t i = 0; i < d; ++i)
+        log_drift_[i] = rate_ - 0.5 * vols_[i] * vols_[i];
+
+    // Cholesky-Banachiewicz, stored transposed so rows of L^T are contiguous
+    std::vector<double> L(d * d, 0.0);
+    for (std::size_t i = 0; i < d; ++i)
+    {
+        for (std::size_t j = 0; j <= i; ++j)
+        {
+            double sum = correlation[i * d + j];
+            for (std::size_t k = 0; k < j; ++k)
+                sum -= L[i * d + k] * L[j * d + k];
+
+            if (i == j)
+            {
+                if (!(sum > 0.0))
+                    throw std::invalid_argument(
+                        "correlation matrix is not positive definite"
+                    );
+                L[i * d + i] = std::sqrt(sum);
+            }
+            else 
+                L[i * d + j] = sum / L[j * d + j];
+        }
+    }
+
+    chol_t_.assign(d * d, 0.0);
+    for (std::size_t i = 0; i < d; ++i)
+        for (std::size_t j = 0; j <= i; ++j)
+            chol_t_[j * d + i] = L[i * d + j];
+}
+
+void MultiAssetBlackScholesModel::correlate(
+    const double* Z, 
+    double* W, 
+    std::size_t n_paths
+) const
+{
+    const std::size_t d = n_assets();
+    const double* Lt = chol_t_.data();
+    std::fill(W, W + n_paths * d, 0.0);
+
+    for (std::size_t p0 = 0; p0 < n_paths; p0 += path_tile)
+    {
+        std::size_t p1 = std::min(p0 + path_tile, n_paths);
+        for (std::size_t j0 = 0; j0 < d; j0 += asset_tile)
+        {
+            std::size_t j1 = std::min(j0 + asset_tile, d);
+            std::size_t p = p0;
+
+            // Four paths at a time share each load of a row of L^T
+            for (; p + 4 <= p1; p += 4)
+            {
+                const double* z = Z + p * d; 
+                double* w0 = W + p * d;
+                double* w1 = w0 + d; 
+                double* w2 = w1 + d; 
+                double* w3 = w2 + d;
+                for (std::size_t j = j0; j < j1; ++j)
+                {
+                    // L is lower triangular: draw j only feeds assets i >= j
+                    const double z0 = z[j], z1 = z[d + j]; 
+                    const double z2 = z[2 * d + j], z3 = z[3 * d + j];
+                    const double* row = Lt + j * d;
+                    for (std::size_t i = j; i < d; ++i)
+                    {
+                        const double l = row[i];
+                        w0[i] += z0 * l; 
+                        w1[i] += z1 * l; 
+                        w2[i] += z2 * l; 
+                        w3[i] += z3 * l;
+                    }
+                }
+            }
+            for (; p < p1; ++p)
+            {
+                const double* z = Z + p * d; 
+                double* w = W + p * d;
+                for (std::size_t j = j0; j < j1; ++j)
+                {
+                    const double zj = z[j];
+                    const double* row = Lt + j * d;
+                    for (std::size_t i = j; i < d; ++i)
+                        w[i] += zj * row[i];
+                }
+            }
+        }
+    }
+}
+
+void MultiAssetBlackScholesModel::simulate_block(
+    double t, 
+    double* W, 
+    std::size_t n_paths
+) const
+{
+    const std::size_t d = n_assets();
+    const double sqrt_t = std::sqrt(t);
+    const double* mu = log_drift_.data();
+    const double* vol = vols_.data();
+    const double* S0 = spots_.data();
+
+    for (std::size_t p = 0; p < n_paths; ++p)
+    {
+        double* w = W + p * d;
+        for (std::size_t i = 0; i < d; ++i)
+            w[i] = S0[i] * std::exp(mu[i] * t + vol[i] * sqrt_t * w[i]);
+    }
+}
\ No newline at end of file
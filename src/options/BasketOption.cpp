@@ -0,0 +1,23 @@
+#include "options/BasketOption.hpp"
+#include <algorithm>
+
+BasketOption::BasketOption(
+    std::vector<double> weights, 
+    double strike, 
+    double maturity, 
+    OptionType type
+)
+: weights_(std::move(weights)), strike_(strike), maturity_(maturity), 
+type_(type) {}
+
+double BasketOption::payoff(const double* ST) const 
+{
+    double basket = 0.0; 
+    for (std::size_t i = 0; i < weights_.size(); ++i)
+        basket += weights_[i] * ST[i];
+
+    if (type_ == OptionType::Call)
+        return std::max(basket - strike_, 0.0);
+    else 
+        return std::max(strike_ - basket, 0.0); 
+}
@@ -0,0 +1,40 @@
+#include "options/BermudanOption.hpp"
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+BermudanOption::BermudanOption(
+    double strike, 
+    std::vector<double> exercise_dates, 
+    OptionType type
+)
+: strike_(strike), dates_(std::move(exercise_dates)), type_(type) 
+{
+    if (dates_.empty() || dates_.front() <= 0.0 
+        || std::adjacent_find(dates_.begin(), dates_.end(), std::greater_equal<double>()) 
+           != dates_.end())
+        throw std::invalid_argument(
+            "exercise dates must be positive and strictly increasing"
+        );
+}
+
+BermudanOption BermudanOption::american(
+    double strike, 
+    double maturity, 
+    std::size_t n_dates, 
+    OptionType type
+)
+{
+    std::vector<double> dates(n_dates);
+    for (std::size_t k = 0; k < n_dates; ++k)
+        dates[k] = maturity * (k + 1) / n_dates;
+    return BermudanOption(strike, std::move(dates), type);
+}
+
+double BermudanOption::payoff(double ST) const 
+{
+    if (type_ == OptionType::Call)
+        return std::max(ST - strike_, 0.0);
+    else 
+        return std::max(strike_ - ST, 0.0); 
+}
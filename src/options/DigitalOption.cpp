@@ -10,8 +10,5 @@ DigitalOption::DigitalOption(
 
 double DigitalOption::payoff(double ST) const
 {
-    if (type_ == OptionType::Call)
-        return  (ST > strike_) ? payout_ : 0.0;
-    else 
-        return  (ST < strike_) ? payout_ : 0.0;
+    return payoff<double>(ST);
 }
\ No newline at end of file
@@ -10,8 +10,5 @@ EuropeanOption::EuropeanOption(
 
 double EuropeanOption::payoff(double ST) const 
 {
-    if (type_ == OptionType::Call)
-        return std::max(ST - strike_, 0.0);
-    else 
-        return std::max(strike_ - ST, 0.0); 
+    return payoff<double>(ST);
 }
\ No newline at end of file
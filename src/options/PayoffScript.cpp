@@ -0,0 +1,491 @@
+#include "options/PayoffScript.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+using Op = PayoffScript::Op;
+
+namespace
+{
+    /// Expression tree produced by the parser and consumed by the code generator.
+    struct Node
+    {
+        enum class Kind { Number, Load, Unary, Binary, Select } kind; 
+        Op op = Op::Const; 
+        double value = 0.0; 
+        std::uint32_t index = 0;
+        std::vector<std::unique_ptr<Node>> args;
+    };
+
+    using NodePtr = std::unique_ptr<Node>;
+
+    NodePtr make_number(double value)
+    {
+        auto node = std::make_unique<Node>(); 
+        node->kind = Node::Kind::Number; 
+        node->value = value; 
+        return node;
+    }
+
+    double apply(Op op, double a, double b)
+    {
+        switch (op)
+        {
+            case Op::Add: return a + b; 
+            case Op::Sub: return a - b; 
+            case Op::Mul: return a * b; 
+            case Op::Div: return a / b; 
+            case Op::Max: return std::max(a, b); 
+            case Op::Min: return std::min(a, b); 
+            case Op::Less: return a < b ? 1.0 : 0.0; 
+            case Op::LessEq: return a <= b ? 1.0 : 0.0; 
+            case Op::Greater: return a > b ? 1.0 : 0.0; 
+            case Op::GreaterEq: return a >= b ? 1.0 : 0.0; 
+            case Op::Neg: return -a; 
+            case Op::Abs: return std::abs(a); 
+            case Op::Exp: return std::exp(a); 
+            case Op::Log: return std::log(a); 
+            default: return 0.0;
+        }
+    }
+
+    /// Builds a node, folding it when every argument is a constant.
+    NodePtr make_op(Node::Kind kind, Op op, NodePtr a, NodePtr b = nullptr)
+    {
+        bool constant = a->kind == Node::Kind::Number 
+                        && (!b || b->kind == Node::Kind::Number);
+        if (constant)
+            return make_number(apply(op, a->value, b ? b->value : 0.0));
+
+        auto node = std::make_unique<Node>(); 
+        node->kind = kind; 
+        node->op = op;
+        node->args.push_back(std::move(a)); 
+        if (b)
+            node->args.push_back(std::move(b));
+        return node;
+    }
+
+    /// Recursive descent parser over the grammar in PayoffScript.hpp.
+    class Parser
+    {
+    public: 
+        explicit Parser(const std::string& source) : src_(source) {}
+
+        NodePtr parse()
+        {
+            NodePtr node = expression(); 
+            skip_space(); 
+            if (pos_ != src_.size())
+                fail("unexpected '" + std::string(1, src_[pos_]) + "'");
+            return node;
+        }
+
+        std::size_t n_observations() const { return n_observations_; }
+
+    private: 
+        [[noreturn]] void fail(const std::string& message) const
+        {
+            throw std::invalid_argument(
+                "payoff script: " + message + " at offset " + std::to_string(pos_)
+            );
+        }
+
+        void skip_space()
+        {
+            while (pos_ < src_.size() && std::isspace(static_cast<unsigned char>(src_[pos_])))
+                ++pos_;
+        }
+
+        bool accept(const char* token)
+        {
+            skip_space(); 
+            std::size_t len = std::strlen(token);
+            if (src_.compare(pos_, len, token) != 0)
+                return false; 
+            pos_ += len; 
+            return true;
+        }
+
+        void expect(const char* token)
+        {
+            if (!accept(token))
+                fail(std::string("expected '") + token + "'");
+        }
+
+        NodePtr expression()
+        {
+            NodePtr left = sum();
+            // Two-character operators first so '<=' is not read as '<'
+            static const std::pair<const char*, Op> comparisons[] = {
+                {"<=", Op::LessEq}, {">=", Op::GreaterEq}, {"<", Op::Less}, {">", Op::Greater}
+            };
+            for (const auto& [token, op] : comparisons)
+                if (accept(token))
+                    return make_op(Node::Kind::Binary, op, std::move(left), sum());
+            return left;
+        }
+
+        NodePtr sum()
+        {
+            NodePtr left = product(); 
+            for (;;)
+            {
+                if (accept("+"))
+                    left = make_op(Node::Kind::Binary, Op::Add, std::move(left), product());
+                else if (accept("-"))
+                    left = make_op(Node::Kind::Binary, Op::Sub, std::move(left), product());
+                else 
+                    return left;
+            }
+        }
+
+        NodePtr product()
+        {
+            NodePtr left = unary(); 
+            for (;;)
+            {
+                if (accept("*"))
+                    left = make_op(Node::Kind::Binary, Op::Mul, std::move(left), unary());
+                else if (accept("/"))
+                    left = make_op(Node::Kind::Binary, Op::Div, std::move(left), unary());
+                else 
+                    return left;
+            }
+        }
+
+        NodePtr unary()
+        {
+            if (accept("-"))
+                return make_op(Node::Kind::Unary, Op::Neg, unary());
+            return primary();
+        }
+
+        std::vector<NodePtr> arguments()
+        {
+            std::vector<NodePtr> args; 
+            expect("(");
+            do 
+                args.push_back(expression()); 
+            while (accept(","));
+            expect(")");
+            return args;
+        }
+
+        NodePtr primary()
+        {
+            skip_space(); 
+            if (pos_ >= src_.size())
+                fail("unexpected end of script");
+
+            char c = src_[pos_];
+            if (std::isdigit(static_cast<unsigned char>(c)) || c == '.')
+            {
+                char* end = nullptr;
+                double value = std::strtod(src_.c_str() + pos_, &end); 
+                pos_ = static_cast<std::size_t>(end - src_.c_str());
+                return make_number(value);
+            }
+            if (accept("("))
+            {
+                NodePtr node = expression(); 
+                expect(")"); 
+                return node;
+            }
+
+            std::size_t start = pos_;
+            while (pos_ < src_.size() && std::isalnum(static_cast<unsigned char>(src_[pos_])))
+                ++pos_;
+            std::string name = src_.substr(start, pos_ - start);
+
+            if (name == "ST")
+                return load(PayoffScript::terminal);
+            if (name == "S")
+            {
+                expect("[");
+                skip_space();
+                std::size_t digits = pos_;
+                while (pos_ < src_.size() && std::isdigit(static_cast<unsigned char>(src_[pos_])))
+                    ++pos_;
+                if (digits == pos_)
+                    fail("expected an observation index");
+                std::uint32_t index = static_cast<std::uint32_t>(
+                    std::stoul(src_.substr(digits, pos_ - digits)));
+                expect("]");
+                n_observations_ = std::max<std::size_t>(n_observations_, index + 1);
+                return load(index);
+            }
+            if (name == "max" || name == "min")
+            {
+                std::vector<NodePtr> args = arguments(); 
+                Op op = name == "max" ? Op::Max : Op::Min;
+                NodePtr node = std::move(args[0]);
+                for (std::size_t i = 1; i < args.size(); ++i)
+                    node = make_op(Node::Kind::Binary, op, std::move(node), std::move(args[i]));
+                return node;
+            }
+            if (name == "abs" || name == "exp" || name == "log")
+            {
+                std::vector<NodePtr> args = arguments(); 
+                if (args.size() != 1)
+                    fail(name + " takes one argument");
+                Op op = name == "abs" ? Op::Abs : name == "exp" ? Op::Exp : Op::Log;
+                return make_op(Node::Kind::Unary, op, std::move(args[0]));
+            }
+            if (name == "if")
+            {
+                std::vector<NodePtr> args = arguments(); 
+                if (args.size() != 3)
+                    fail("if takes a condition and two branches");
+                if (args[0]->kind == Node::Kind::Number)
+                    return std::move(args[args[0]->value != 0.0 ? 1 : 2]);
+                auto node = std::make_unique<Node>(); 
+                node->kind = Node::Kind::Select; 
+                node->op = Op::Select; 
+                node->args = std::move(args);
+                return node;
+            }
+            pos_ = start;
+            fail(name.empty() ? "expected a value" : "unknown name '" + name + "'");
+        }
+
+        NodePtr load(std::uint32_t index)
+        {
+            auto node = std::make_unique<Node>(); 
+            node->kind = Node::Kind::Load; 
+            node->index = index; 
+            return node;
+        }
+
+        const std::string& src_; 
+        std::size_t pos_ = 0; 
+        std::size_t n_observations_ = 1;
+    };
+
+    /// Variant of a binary op taking its right operand as an immediate.
+    bool immediate_form(Op op, Op& out)
+    {
+        switch (op)
+        {
+            case Op::Add: out = Op::AddC; return true; 
+            case Op::Sub: out = Op::SubC; return true; 
+            case Op::Mul: out = Op::MulC; return true; 
+            case Op::Div: out = Op::DivC; return true; 
+            case Op::Max: out = Op::MaxC; return true; 
+            case Op::Min: out = Op::MinC; return true; 
+            case Op::Less: out = Op::LessC; return true; 
+            case Op::LessEq: out = Op::LessEqC; return true; 
+            case Op::Greater: out = Op::GreaterC; return true; 
+            case Op::GreaterEq: out = Op::GreaterEqC; return true; 
+            default: return false;
+        }
+    }
+
+    /// The op giving the same result with operands swapped, for constants on the left.
+    Op swapped(Op op)
+    {
+        switch (op)
+        {
+            case Op::Less: return Op::Greater; 
+            case Op::LessEq: return Op::GreaterEq; 
+            case Op::Greater: return Op::Less; 
+            case Op::GreaterEq: return Op::LessEq; 
+            default: return op;
+        }
+    }
+
+    class CodeGenerator
+    {
+    public: 
+        CodeGenerator(
+            std::vector<PayoffScript::Instruction>& code, 
+            std::vector<double>& constants
+        )
+        : code_(code), constants_(constants) {}
+
+        void emit(const Node& node)
+        {
+            switch (node.kind)
+            {
+                case Node::Kind::Number: 
+                    push(Op::Const, constant(node.value), +1); 
+                    return;
+                case Node::Kind::Load: 
+                    push(Op::Load, node.index, +1); 
+                    return;
+                case Node::Kind::Unary: 
+                    emit(*node.args[0]); 
+                    push(node.op, 0, 0); 
+                    return;
+                case Node::Kind::Select: 
+                    for (const NodePtr& arg : node.args)
+                        emit(*arg);
+                    push(Op::Select, 0, -2); 
+                    return;
+                case Node::Kind::Binary: 
+                    binary(node); 
+                    return;
+            }
+        }
+
+        std::size_t depth() const { return max_depth_; }
+
+    private: 
+        void binary(const Node& node)
+        {
+            const Node& a = *node.args[0]; 
+            const Node& b = *node.args[1]; 
+            Op op = node.op; 
+            Op imm;
+
+            if (b.kind == Node::Kind::Number && immediate_form(op, imm))
+            {
+                emit(a); 
+                push(imm, constant(b.value), 0);
+            }
+            else if (a.kind == Node::Kind::Number && op == Op::Sub)
+            {
+                emit(b); 
+                push(Op::RSubC, constant(a.value), 0);
+            }
+            else if (a.kind == Node::Kind::Number && op != Op::Div 
+                     && immediate_form(swapped(op), imm))
+            {
+                emit(b); 
+                push(imm, constant(a.value), 0);
+            }
+            else 
+            {
+                emit(a); 
+                emit(b); 
+                push(op, 0, -1);
+            }
+        }
+
+        std::uint32_t constant(double value)
+        {
+            constants_.push_back(value); 
+            return static_cast<std::uint32_t>(constants_.size() - 1);
+        }
+
+        void push(Op op, std::uint32_t arg, int stack_change)
+        {
+            code_.push_back({op, arg}); 
+            depth_ += stack_change; 
+            max_depth_ = std::max(max_depth_, static_cast<std::size_t>(depth_));
+        }
+
+        std::vector<PayoffScript::Instruction>& code_; 
+        std::vector<double>& constants_; 
+        int depth_ = 0; 
+        std::size_t max_depth_ = 0;
+    };
+}
+
+PayoffScript::PayoffScript(const std::string& source)
+: source_(source)
+{
+    Parser parser(source_); 
+    NodePtr tree = parser.parse(); 
+    n_observations_ = parser.n_observations();
+
+    CodeGenerator generator(code_, constants_); 
+    generator.emit(*tree); 
+    stack_depth_ = generator.depth();
+    if (stack_depth_ > max_stack_depth)
+        throw std::invalid_argument("payoff script nests too deeply");
+}
+
+void PayoffScript::evaluate(
+    const double* const* observations, 
+    std::size_t n_dates, 
+    std::size_t n, 
+    double* out, 
+    double* scratch
+) const
+{
+    if (n_dates < n_observations_)
+        throw std::invalid_argument("payoff script reads more observation dates than given");
+
+    // Stack entries point either at an observation column (loads are free) 
+    // or at their own scratch slot, which every op writes its result into
+    const double* stack[max_stack_depth];
+    std::size_t sp = 0;
+    auto slot = [&](std::size_t i) { return scratch + i * n; };
+
+    for (const Instruction& ins : code_)
+    {
+        double c = ins.arg < constants_.size() ? constants_[ins.arg] : 0.0;
+        switch (ins.op)
+        {
+            case Op::Load: 
+                stack[sp++] = observations[ins.arg == terminal ? n_dates - 1 : ins.arg];
+                continue;
+            case Op::Const: 
+            {
+                double* r = slot(sp); 
+                std::fill(r, r + n, c); 
+                stack[sp++] = r; 
+                continue;
+            }
+            case Op::Select: 
+            {
+                const double* cond = stack[sp - 3]; 
+                const double* a = stack[sp - 2]; 
+                const double* b = stack[sp - 1]; 
+                double* r = slot(sp - 3); 
+                for (std::size_t i = 0; i < n; ++i)
+                    r[i] = cond[i] != 0.0 ? a[i] : b[i];
+                sp -= 2; 
+                stack[sp - 1] = r;
+                continue;
+            }
+            default: 
+                break;
+        }
+
+        // Two-operand ops are declared from Add through GreaterEq
+        bool binary = ins.op <= Op::GreaterEq;
+        const double* x = stack[sp - (binary ? 2 : 1)]; 
+        const double* y = stack[sp - 1];
+        if (binary)
+            --sp;
+        double* r = slot(sp - 1);
+
+        switch (ins.op)
+        {
+            case Op::Add: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] + y[i]; break;
+            case Op::Sub: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] - y[i]; break;
+            case Op::Mul: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] * y[i]; break;
+            case Op::Div: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] / y[i]; break;
+            case Op::Max: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] > y[i] ? x[i] : y[i]; break;
+            case Op::Min: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] < y[i] ? x[i] : y[i]; break;
+            case Op::Less: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] < y[i] ? 1.0 : 0.0; break;
+            case Op::LessEq: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] <= y[i] ? 1.0 : 0.0; break;
+            case Op::Greater: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] > y[i] ? 1.0 : 0.0; break;
+            case Op::GreaterEq: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] >= y[i] ? 1.0 : 0.0; break;
+            case Op::AddC: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] + c; break;
+            case Op::SubC: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] - c; break;
+            case Op::RSubC: for (std::size_t i = 0; i < n; ++i) r[i] = c - x[i]; break;
+            case Op::MulC: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] * c; break;
+            case Op::DivC: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] / c; break;
+            case Op::MaxC: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] > c ? x[i] : c; break;
+            case Op::MinC: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] < c ? x[i] : c; break;
+            case Op::LessC: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] < c ? 1.0 : 0.0; break;
+            case Op::LessEqC: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] <= c ? 1.0 : 0.0; break;
+            case Op::GreaterC: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] > c ? 1.0 : 0.0; break;
+            case Op::GreaterEqC: for (std::size_t i = 0; i < n; ++i) r[i] = x[i] >= c ? 1.0 : 0.0; break;
+            case Op::Neg: for (std::size_t i = 0; i < n; ++i) r[i] = -x[i]; break;
+            case Op::Abs: for (std::size_t i = 0; i < n; ++i) r[i] = std::abs(x[i]); break;
+            case Op::Exp: for (std::size_t i = 0; i < n; ++i) r[i] = std::exp(x[i]); break;
+            case Op::Log: for (std::size_t i = 0; i < n; ++i) r[i] = std::log(x[i]); break;
+            default: break;
+        }
+        stack[sp - 1] = r;
+    }
+    std::copy(stack[0], stack[0] + n, out);
+}
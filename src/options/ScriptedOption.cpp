@@ -0,0 +1,40 @@
+#include "options/ScriptedOption.hpp"
+#include <stdexcept>
+
+ScriptedOption::ScriptedOption(const std::string& source, std::vector<double> dates)
+: script_(source), dates_(std::move(dates))
+{
+    if (dates_.empty())
+        throw std::invalid_argument("scripted option needs an observation date");
+    for (std::size_t k = 1; k < dates_.size(); ++k)
+        if (dates_[k] <= dates_[k - 1])
+            throw std::invalid_argument("observation dates must increase");
+    if (script_.n_observations() > dates_.size())
+        throw std::invalid_argument("payoff script reads more dates than the option has");
+}
+
+ScriptedOption::ScriptedOption(const std::string& source, double maturity)
+: ScriptedOption(source, std::vector<double>{maturity}) {}
+
+double ScriptedOption::payoff(double ST) const
+{
+    if (script_.n_observations() > 1)
+        throw std::logic_error("payoff script reads intermediate dates; price it with ScriptedEngine");
+
+    // Slow path, one path per dispatch; engines should use payoff_block
+    double scratch[PayoffScript::max_stack_depth];
+    const double* observations[] = {&ST};
+    double out; 
+    script_.evaluate(observations, 1, 1, &out, scratch);
+    return out;
+}
+
+void ScriptedOption::payoff_block(
+    const double* const* observations, 
+    std::size_t n, 
+    double* out, 
+    double* scratch
+) const
+{
+    script_.evaluate(observations, dates_.size(), n, out, scratch);
+}
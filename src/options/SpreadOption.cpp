@@ -0,0 +1,27 @@
+#include "options/SpreadOption.hpp"
+#include <algorithm>
+
+SpreadOption::SpreadOption(
+    std::size_t long_asset, 
+    std::size_t short_asset, 
+    double strike, 
+    double maturity, 
+    OptionType type
+)
+: long_(long_asset), short_(short_asset), strike_(strike), 
+maturity_(maturity), type_(type) {}
+
+std::size_t SpreadOption::n_assets() const
+{
+    return std::max(long_, short_) + 1;
+}
+
+double SpreadOption::payoff(const double* ST) const 
+{
+    double spread = ST[long_] - ST[short_];
+
+    if (type_ == OptionType::Call)
+        return std::max(spread - strike_, 0.0);
+    else 
+        return std::max(strike_ - spread, 0.0); 
+}
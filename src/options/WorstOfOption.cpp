@@ -0,0 +1,30 @@
+#include "options/WorstOfOption.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+WorstOfOption::WorstOfOption(
+    std::vector<double> reference, 
+    double strike, 
+    double maturity, 
+    OptionType type
+)
+: inv_reference_(std::move(reference)), strike_(strike), maturity_(maturity), 
+type_(type) 
+{
+    if (inv_reference_.empty())
+        throw std::invalid_argument("worst-of option needs at least one asset");
+    for (double& level : inv_reference_)
+        level = 1.0 / level;
+}
+
+double WorstOfOption::payoff(const double* ST) const 
+{
+    double worst = ST[0] * inv_reference_[0]; 
+    for (std::size_t i = 1; i < inv_reference_.size(); ++i)
+        worst = std::min(worst, ST[i] * inv_reference_[i]);
+
+    if (type_ == OptionType::Call)
+        return std::max(worst - strike_, 0.0);
+    else 
+        return std::max(strike_ - worst, 0.0); 
+}
@@ -14,4 +14,18 @@ double ControlSampler::sample(double Z) const
     double X = target_->sample(Z); 
     double Y = control_->sample(Z); 
     return X - beta_ * (Y - control_mean_); 
+}
+
+bool ControlSampler::records_paths() const
+{
+    return target_->records_paths() && control_->records_paths();
+}
+
+double ControlSampler::record(double Z, PathRecord& out) const
+{
+    PathRecord control; 
+    double X = target_->record(Z, out); 
+    double Y = control_->record(Z, control); 
+    out.control = control.payoff;
+    return X - beta_ * (Y - control_mean_); 
 }
\ No newline at end of file
@@ -0,0 +1,29 @@
+#include "samplers/FusedAntitheticControlSampler.hpp"
+#include <stdexcept>
+
+FusedAntitheticControlSampler::FusedAntitheticControlSampler(
+    const Model& model, 
+    const Option& option, 
+    const Option& control, 
+    double control_mean, 
+    double beta
+)
+: model_(model), option_(option), control_(control), 
+control_mean_(control_mean), beta_(beta) 
+{
+    // Both payoffs read the terminal price simulated at the target's maturity
+    if (control.maturity() != option.maturity())
+        throw std::invalid_argument("fused control must share the option's maturity");
+}
+
+double FusedAntitheticControlSampler::sample(double Z) const
+{
+    double T = option_.maturity();
+
+    double ST1 = model_.simulate(T, Z); 
+    double ST2 = model_.simulate(T, -Z);
+
+    double X = 0.5 * (option_.payoff(ST1) + option_.payoff(ST2));
+    double Y = 0.5 * (control_.payoff(ST1) + control_.payoff(ST2));
+    return X - beta_ * (Y - control_mean_);
+}
@@ -0,0 +1,34 @@
+#include "samplers/FusedControlSampler.hpp"
+#include <stdexcept>
+
+FusedControlSampler::FusedControlSampler(
+    const Model& model, 
+    const Option& option, 
+    const Option& control, 
+    double control_mean, 
+    double beta
+)
+: model_(model), option_(option), control_(control), 
+control_mean_(control_mean), beta_(beta) 
+{
+    // Both payoffs read the terminal price simulated at the target's maturity
+    if (control.maturity() != option.maturity())
+        throw std::invalid_argument("fused control must share the option's maturity");
+}
+
+double FusedControlSampler::sample(double Z) const
+{
+    double ST = model_.simulate(option_.maturity(), Z); 
+    double X = option_.payoff(ST); 
+    double Y = control_.payoff(ST);
+    return X - beta_ * (Y - control_mean_); 
+}
+
+double FusedControlSampler::record(double Z, PathRecord& out) const
+{
+    double ST = model_.simulate(option_.maturity(), Z); 
+    out.terminal = ST; 
+    out.payoff = option_.payoff(ST); 
+    out.control = control_.payoff(ST);
+    return out.payoff - beta_ * (out.control - control_mean_); 
+}
\ No newline at end of file
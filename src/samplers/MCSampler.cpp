@@ -15,4 +15,13 @@ double MCSampler::sample(double Z) const
 
     double ST = model_.simulate(T, Z); 
     return option_.payoff(ST);
+}
+
+double MCSampler::record(double Z, PathRecord& out) const 
+{
+    double ST = model_.simulate(option_.maturity(), Z); 
+    out.terminal = ST; 
+    out.payoff = option_.payoff(ST); 
+    out.control = std::numeric_limits<double>::quiet_NaN();
+    return out.payoff;
 }
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include "samplers/SmoothedDigitalSampler.hpp"
+#include <cmath>
+#include <stdexcept>
+
+static constexpr double pi = 3.14159265358979323846;
+
+static double norm_cdf(double x) {
+    return 0.5 * std::erfc(-x / std::sqrt(2)); 
+}
+
+static double norm_pdf(double x) {
+    return std::exp(-0.5 * x * x) / std::sqrt(2 * pi); 
+}
+
+SmoothedDigitalSampler::SmoothedDigitalSampler(
+    const BlackScholesModel& model, 
+    const DigitalOption& option, 
+    DigitalSmoothing smoothing, 
+    double width
+)
+: model_(model), option_(option), smoothing_(smoothing), width_(width), 
+sign_(option.type() == OptionType::Call ? 1.0 : -1.0) 
+{
+    if (width_ <= 0.0)
+        throw std::invalid_argument("smoothing width must be positive");
+    if (smoothing_ == DigitalSmoothing::ConditionalExpectation 
+        && width_ > option_.maturity())
+        throw std::invalid_argument("last step cannot exceed the maturity");
+}
+
+double SmoothedDigitalSampler::sample(double Z) const
+{
+    double T = option_.maturity(); 
+    double K = option_.strike(); 
+
+    if (smoothing_ == DigitalSmoothing::Kernel)
+    {
+        double ST = model_.simulate(T, Z); 
+        return option_.payout() * norm_cdf(sign_ * (ST - K) / width_);
+    }
+
+    // P(ST > K | S at T - dt) over the remaining step dt
+    double vol = model_.volatility(); 
+    double dt = width_;
+    double S = model_.simulate(T - dt, Z); 
+    double d2 = (std::log(S / K) + (model_.rate() - 0.5 * vol * vol) * dt) 
+                / (vol * std::sqrt(dt));
+    return option_.payout() * norm_cdf(sign_ * d2);
+}
+
+double SmoothedDigitalSampler::pathwise_delta(double Z) const
+{
+    double T = option_.maturity(); 
+    double K = option_.strike(); 
+    double spot = model_.spot();
+
+    // Every simulated price scales linearly in spot: dS/dspot = S / spot
+    if (smoothing_ == DigitalSmoothing::Kernel)
+    {
+        double ST = model_.simulate(T, Z); 
+        double x = (ST - K) / width_;
+        return sign_ * option_.payout() * norm_pdf(sign_ * x) / width_ * ST / spot;
+    }
+
+    double vol = model_.volatility(); 
+    double dt = width_;
+    double S = model_.simulate(T - dt, Z); 
+    double v = vol * std::sqrt(dt);
+    double d2 = (std::log(S / K) + (model_.rate() - 0.5 * vol * vol) * dt) / v;
+    return sign_ * option_.payout() * norm_pdf(d2) / (v * spot);
+}
@@ -0,0 +1,36 @@
+#include "core/NormalStore.hpp"
+#include <iostream>
+#include <string>
+#include <exception>
+
+/// Writes a versioned, checksummed file of standard Normal draws that 
+/// MappedNormalStore can serve to any number of pricing processes.
+int main(int argc, char** argv)
+{
+    if (argc < 3 || argc > 4)
+    {
+        std::cerr << "usage: " << argv[0] << " <file> <count> [seed]\n";
+        return 1;
+    }
+
+    try 
+    {
+        std::string path = argv[1];
+        std::size_t count = std::stoull(argv[2]);
+        unsigned int seed = argc == 4 
+            ? static_cast<unsigned int>(std::stoul(argv[3])) 
+            : 1310;
+
+        write_normal_store(path, count, seed);
+
+        MappedNormalStore store(path);
+        std::cout << "Wrote " << store.size() << " draws (seed " 
+                  << store.seed() << ") to " << path << '\n';
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "error: " << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,38 @@
+#include "core/ShardedRun.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <exception>
+
+/// Combines the shard files written by option_pricer --shard i/n --out FILE 
+/// into the price and standard error of the full run.
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " <shard file>...\n";
+        return 1;
+    }
+
+    try 
+    {
+        std::vector<ShardResult> shards;
+        for (int i = 1; i < argc; ++i)
+            shards.push_back(read_shard(argv[i]));
+
+        OnlineStatistics stats = merge_shards(shards);
+        double discount = shards.front().discount;
+
+        std::cout << std::setprecision(17) 
+                  << "Price: " << discount * stats.mean() 
+                  << " SE: " << discount * stats.standard_error() 
+                  << " Paths: " << stats.count() << '\n';
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "error: " << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
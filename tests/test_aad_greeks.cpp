@@ -0,0 +1,67 @@
+#include "analytics/Greeks.hpp"
+#include "analytics/BlackScholesClosedForm.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+int main()
+{
+    double S = 100.0;
+    double r = 0.05;
+    double v = 0.2;
+    double T = 1.0;
+    std::size_t n_paths = 200'000;
+
+    BlackScholesModel model(S, r, v);
+    bool ok = true;
+
+    std::cout << std::setprecision(6);
+    std::cout << "============ AAD Greeks Results ============" << '\n';
+
+    for (OptionType type : {OptionType::Call, OptionType::Put})
+    {
+        double K = type == OptionType::Call ? 105.0 : 95.0;
+        EuropeanOption option(K, T, type);
+
+        auto bs = [&](double spot, double rate, double vol, double maturity) {
+            return black_scholes_price(spot, K, rate, vol, maturity, type);
+        };
+        double h = 1e-5;
+        Greeks exact{
+            bs(S, r, v, T), 
+            (bs(S + h, r, v, T) - bs(S - h, r, v, T)) / (2 * h), 
+            (bs(S, r, v + h, T) - bs(S, r, v - h, T)) / (2 * h), 
+            (bs(S, r + h, v, T) - bs(S, r - h, v, T)) / (2 * h), 
+            -(bs(S, r, v, T + h) - bs(S, r, v, T - h)) / (2 * h)
+        };
+
+        RandomEngine rng(1310);
+        GreeksEstimate aad = aad_greeks(model, option, n_paths, rng);
+        Greeks bump = bump_greeks(model, option, n_paths, 1310);
+
+        // Against the closed form to sampling error; against bumping on the 
+        // same draws to the bump's truncation error
+        auto check = [&](const std::string& name, double a, double se, double e, double b) {
+            bool close = std::abs(a - e) < 4.0 * se && std::abs(a - b) < 1e-3 * std::abs(e);
+            print_row(" " + name + " AAD:", a);
+            print_row("   closed form / bump:", std::to_string(e) + " / " + std::to_string(b));
+            ok = ok && close;
+        };
+
+        std::cout << (type == OptionType::Call ? "Call" : "Put") << " K=" << K << '\n';
+        check("Delta", aad.value.delta, aad.standard_error.delta, exact.delta, bump.delta);
+        check("Vega", aad.value.vega, aad.standard_error.vega, exact.vega, bump.vega);
+        check("Rho", aad.value.rho, aad.standard_error.rho, exact.rho, bump.rho);
+        check("Theta", aad.value.theta, aad.standard_error.theta, exact.theta, bump.theta);
+    }
+
+    return ok ? 0 : 1;
+}
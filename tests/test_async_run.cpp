@@ -0,0 +1,88 @@
+#include "samplers/MCSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/NormalStore.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <stdexcept>
+#include <cstdio>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+int main()
+{
+    BlackScholesModel model(100.0, 0.05, 0.2);
+    EuropeanOption call(100.0, 1.0, OptionType::Call);
+    MCSampler sampler(model, call);
+    MonteCarloEngine engine(sampler);
+
+    // Not a whole number of blocks, so the last block is partial
+    const std::size_t n_paths = 2'000'003;
+    const std::size_t publish_every = 8 * MonteCarloEngine::block_size;
+
+    RandomEngine rng(1310);
+    AsyncRun run = engine.run_async(n_paths, rng, publish_every);
+
+    // Snapshots never go backwards and partial ones fall on block boundaries
+    std::size_t partials = 0, last = 0;
+    bool monotone = true, aligned = true;
+    PricingSnapshot snap;
+    do
+    {
+        snap = run.snapshot();
+        monotone = monotone && snap.paths_done >= last;
+        if (!snap.finished && snap.paths_done > 0)
+        {
+            aligned = aligned && snap.paths_done % MonteCarloEngine::block_size == 0;
+            partials += snap.paths_done != last;
+        }
+        last = snap.paths_done;
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    while (!snap.finished);
+
+    OnlineStatistics async = run.get();
+    RandomEngine sync_rng(1310);
+    OnlineStatistics sync = engine.run(n_paths, sync_rng);
+    bool identical = async.count() == sync.count() && async.mean() == sync.mean()
+                     && async.m2() == sync.m2();
+    bool final_ok = snap.paths_done == n_paths && snap.mean == sync.mean();
+
+    // A source that runs dry mid-run must surface through get()
+    const std::string file = "test_async_run.bin";
+    write_normal_store(file, 100'000, 1310);
+    bool rethrown = false;
+    bool finished = false;
+    {
+        MappedNormalStore store(file);
+        AsyncRun short_run = engine.run_async(200'000, store, publish_every);
+        try
+        {
+            short_run.get();
+        }
+        catch (const std::out_of_range&)
+        {
+            rethrown = true;
+        }
+        finished = short_run.done();
+    }
+    std::remove(file.c_str());
+
+    std::cout << "============ Async Run Results ============" << '\n';
+    print_row(" Number of Paths:", n_paths);
+    print_row(" Partial snapshots:", partials);
+    print_row(" Monotone:", monotone && aligned ? "yes" : "NO");
+    print_row(" get() vs run():", identical ? "identical" : "MISMATCH");
+    print_row(" Final snapshot:", final_ok ? "complete" : "INCOMPLETE");
+    print_row(" Source exhausted:", rethrown && finished ? "rethrown" : "LOST");
+
+    return partials > 0 && monotone && aligned && identical && final_ok
+           && rethrown && finished ? 0 : 1;
+}
\ No newline at end of file
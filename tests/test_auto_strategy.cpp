@@ -0,0 +1,114 @@
+#include "core/AutoStrategyPricer.hpp"
+#include "core/RandomEngine.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "options/DigitalOption.hpp"
+#include "options/NoOption.hpp"
+#include "market/FlatDiscount.hpp"
+#include "analytics/BlackScholesClosedForm.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+/// Counts the draws taken from a RandomEngine.
+class CountingSource : public NormalSource
+{
+public: 
+    explicit CountingSource(unsigned int seed) : rng_(seed) {}
+
+    double normal() override
+    {
+        ++count_;
+        return rng_.normal();
+    }
+
+    void fill(double* out, std::size_t n) override
+    {
+        count_ += n;
+        rng_.fill(out, n);
+    }
+
+    std::size_t count() const { return count_; }
+
+private: 
+    RandomEngine rng_; 
+    std::size_t count_ = 0;
+};
+
+int main()
+{
+    double S = 100.0;
+    double r = 0.05;
+    double v = 0.2;
+    double T = 1.0;
+
+    FlatDiscount discount(r);
+    BlackScholesModel model(S, r, v);
+    NoOption underlying(T);
+    double forward = S / discount(T);
+    bool ok = true;
+
+    std::cout << std::setprecision(6);
+    std::cout << "============ Auto Strategy Results ============" << '\n';
+
+    // Deep in the money the call moves one for one with the underlying, so a 
+    // control strategy must win and its pilots must show the variance cut
+    {
+        EuropeanOption itm_call(70.0, T, OptionType::Call);
+        std::size_t pilot_paths = 200'000, n_paths = 2'000'000;
+        AutoStrategyPricer pricer(model, itm_call, underlying, forward, pilot_paths);
+        CountingSource rng(1310);
+        AutoPricingResult result = pricer.run(n_paths, rng);
+
+        // The chosen strategy is the most efficient pilot
+        const StrategyPilot* best = &result.pilots.front();
+        for (const StrategyPilot& pilot : result.pilots)
+            if (pilot.efficiency() > best->efficiency())
+                best = &pilot;
+        double plain_variance = result.pilots.front().variance;
+        bool ranked = result.strategy == best->strategy 
+                      && result.expected_speedup == best->efficiency() / result.pilots.front().efficiency();
+        bool control = result.strategy == Strategy::Control 
+                       || result.strategy == Strategy::AntitheticControl;
+        bool variance_cut = result.pilots.size() == 4 
+                            && result.pilots[2].variance < 0.05 * plain_variance 
+                            && result.pilots[3].variance < 0.05 * plain_variance;
+
+        // Calibration stops early here; the pilot count must be what was 
+        // drawn, with two paths per antithetic draw
+        std::size_t main_draws = result.stats.count();
+        std::size_t pilot_draws = rng.count() - main_draws;
+        std::size_t antithetic_extra = 2 * (pilot_paths / 2);
+        bool accounted = result.pilot_paths == pilot_draws + antithetic_extra 
+                         && result.pilot_paths < 5 * pilot_paths;
+
+        double price = discount(T) * result.stats.mean();
+        double se = discount(T) * result.stats.standard_error();
+        double analytic = black_scholes_price(S, 70.0, r, v, T, OptionType::Call);
+        bool priced = std::abs(price - analytic) < 4.0 * se;
+
+        print_row(" ITM call strategy:", strategy_name(result.strategy));
+        print_row(" Expected speedup:", result.expected_speedup);
+        print_row(" Pilot paths:", result.pilot_paths);
+        print_row(" Price:", price);
+        print_row(" Analytic price:", analytic);
+        ok = ok && ranked && control && variance_cut && accounted && priced;
+    }
+
+    // A payoff that never varies gives every pilot zero variance
+    {
+        DigitalOption sure_thing(1e-9, T, 1.0, OptionType::Call);
+        AutoStrategyPricer pricer(model, sure_thing, 10'000);
+        RandomEngine rng(1310);
+        AutoPricingResult result = pricer.run(100'000, rng);
+        print_row(" Constant payoff gain:", result.expected_speedup);
+        ok = ok && result.expected_speedup == 1.0 && result.stats.mean() == 1.0;
+    }
+
+    return ok ? 0 : 1;
+}
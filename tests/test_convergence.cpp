@@ -9,11 +9,14 @@
 #include "core/RandomEngine.hpp"
 #include "analytics/BlackScholesClosedForm.hpp"
 #include "analytics/CalibrateControl.hpp"
+#include "core/ConvergenceRecorder.hpp"
 #include <iostream>
 #include <iomanip>
 #include <string_view>
 #include <memory>
-#include <fstream> 
+#include <cmath>
+#include <stdexcept>
+#include <vector>
 
 int main()
 {
@@ -41,52 +44,87 @@ int main()
         0.01     // error target 
     );
 
-    std::vector<std::size_t> path_counts = {
-        1000, 2000, 5000, 10'000, 20'000, 50'000, 100'000, 1'000'000, 10'000'000
-    };
+    // Three checkpoints per decade; antithetic samples are pairs of paths
+    std::vector<std::size_t> path_counts = geometric_checkpoints(1000, 10'000'000);
+    std::vector<std::size_t> pair_counts; 
+    for (std::size_t n : path_counts)
+        pair_counts.push_back(n / 2);
 
-    std::ofstream csv("../data/convergence_results.csv"); 
-    if (!csv.is_open()) {
+    MCSampler mc_sampler(model, option);
+    AntitheticSampler anti_sampler(model, option);
+    auto cv_target = std::make_unique<MCSampler>(model, option);
+    auto cv_control = std::make_unique<MCSampler>(model, control); 
+    double control_mean = S / discount(T); 
+    ControlSampler cv_sampler(
+        std::move(cv_target), 
+        std::move(cv_control), 
+        control_mean, 
+        beta
+    );
+
+    // One run per sampler, snapshotted at every checkpoint
+    std::vector<OnlineStatistics> mc = record_convergence(mc_sampler, path_counts, {1310})[0];
+    std::vector<OnlineStatistics> anti = record_convergence(anti_sampler, pair_counts, {1310})[0];
+    std::vector<OnlineStatistics> cv = record_convergence(cv_sampler, path_counts, {1310})[0];
+
+    // Moment matching splits the whole run into blocks, so each count is its own run
+    MonteCarloEngine mc_engine(mc_sampler);
+    std::vector<double> mm_se; 
+    for (std::size_t n : path_counts)
+    {
+        RandomEngine mm_rng(1310); 
+        mm_se.push_back(discount(T) * mc_engine.run_moment_matched(n, mm_rng).standard_error);
+    }
+
+    ConvergenceTable table(path_counts);
+    table.add_column("mc_se", mc, discount(T));
+    table.add_column("anti_se", anti, discount(T));
+    table.add_column("cv_se", cv, discount(T));
+    table.add_values("mm_se", mm_se);
+    if (!table.write_csv("../data/convergence_results.csv")) {
     std::cerr << "Failed to open CSV file\n";
     return 1;
     }
-    csv << "paths,mc_se,anti_se,cv_se\n";
 
-    for (auto n : path_counts)
+    // Every checkpoint must match a fresh run of that many paths exactly
+    bool identical = mc.size() == path_counts.size();
+    for (std::size_t k = 0; identical && k < path_counts.size(); ++k)
     {
-    // MCSampler --------------------------------------------------------------
-        MCSampler mc_sampler(model, option);
-        RandomEngine mc_rng(1310); 
-        MonteCarloEngine mc_engine(mc_sampler);
-
-        OnlineStatistics mc_results = mc_engine.run(n, mc_rng);
-        double mc_se = discount(T) * mc_results.standard_error(); 
-
-    // AntitheticSampler ------------------------------------------------------
-        AntitheticSampler anti_sampler(model, option);
-        RandomEngine anti_rng(1310); 
-        MonteCarloEngine anti_engine(anti_sampler); 
-
-        OnlineStatistics anti_results = anti_engine.run(n / 2, anti_rng);
-        double anti_se = discount(T) * anti_results.standard_error();
-
-    // ControlSampler ---------------------------------------------------------
-        auto cv_target = std::make_unique<MCSampler>(model, option);
-        auto cv_control = std::make_unique<MCSampler>(model, control); 
-        double control_mean = S / discount(T); 
-        ControlSampler cv_sampler(
-            std::move(cv_target), 
-            std::move(cv_control), 
-            control_mean, 
-            beta
-        );
-        RandomEngine cv_rng(1310); 
-        MonteCarloEngine cv_engine(cv_sampler);
-        OnlineStatistics cv_results = cv_engine.run(n, cv_rng);
-        double cv_se = discount(T) * cv_results.standard_error();
+        RandomEngine fresh_rng(1310); 
+        OnlineStatistics fresh = mc_engine.run(path_counts[k], fresh_rng);
+        identical = fresh.count() == mc[k].count() 
+                    && fresh.mean() == mc[k].mean() && fresh.m2() == mc[k].m2();
+        if (!identical)
+            std::cerr << "Checkpoint at " << path_counts[k] << " paths differs from a fresh run\n";
+    }
 
-        csv << n << "," << mc_se << "," << anti_se << "," << cv_se << "\n";
+    // Repeated or decreasing checkpoints are rejected
+    bool rejected = true;
+    for (std::vector<std::size_t> bad : {std::vector<std::size_t>{1000, 1000, 2000}, 
+                                         std::vector<std::size_t>{2000, 1000}})
+    {
+        try
+        {
+            ConvergenceRecorder recorder(bad);
+            rejected = false;
+        }
+        catch (const std::invalid_argument&) {}
     }
+    if (!rejected)
+        std::cerr << "Checkpoints that are not strictly increasing were accepted\n";
+
+    // Uneven blocks are weighted by size, so the estimate is the mean over paths
+    std::size_t n_uneven = 1'000'003;
+    ConvergenceRecorder matched_paths({n_uneven});
+    mc_engine.attach(matched_paths);
+    RandomEngine uneven_rng(1310);
+    MomentMatchedResult matched = mc_engine.run_moment_matched(n_uneven, uneven_rng);
+    mc_engine.detach(matched_paths);
+    double path_mean = matched_paths.snapshots().at(0).mean();
+    bool weighted = matched.n_paths == n_uneven 
+                    && std::abs(matched.mean - path_mean) < 1e-12 * std::abs(path_mean);
+    if (!weighted)
+        std::cerr << "Moment-matched mean differs from the mean over paths\n";
 
-    return 0;
+    return identical && rejected && weighted ? 0 : 1;
 }
\ No newline at end of file
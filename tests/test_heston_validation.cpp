@@ -0,0 +1,171 @@
+#include "models/HestonModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "market/FlatDiscount.hpp"
+#include "core/OnlineStatistics.hpp"
+#include "core/RandomEngine.hpp"
+#include "analytics/HestonClosedForm.hpp"
+#include "analytics/BlackScholesClosedForm.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string_view>
+#include <algorithm>
+#include <cmath>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+OnlineStatistics price_heston(
+    const HestonModel& model, 
+    const Option& option, 
+    std::size_t n_paths, 
+    std::size_t n_steps, 
+    RandomEngine& rng
+);
+
+/// Prints the comparison; true if the price is within 4 SE of analytic.
+bool print_result(
+    std::string_view name, 
+    const OnlineStatistics& result, 
+    double discount, 
+    double analytic
+);
+
+/// Largest put-call parity gap of the semi-analytic prices over a few 
+/// strikes, at a nonzero rate so the discounting is exercised.
+double parity_gap(const HestonModel& model, double maturity);
+
+/// Largest gap between semi-analytic calls with almost no vol of vol, 
+/// started at the long-run variance, and Black-Scholes at that volatility. 
+/// The put comes from the call by parity, so this is what exercises the 
+/// characteristic function.
+double black_scholes_limit_gap(double maturity);
+
+int main()
+{
+    // Fang & Oosterlee (2008) test case, reference call 5.785155450
+    double S = 100.0;
+    double r = 0.0;
+    double v0 = 0.0175;
+    double kappa = 1.5768;
+    double theta = 0.0398;
+    double xi = 0.5751;
+    double rho = -0.5711;
+    double T = 1.0;
+    double K = 100.0;
+
+    FlatDiscount discount(r);
+    HestonModel model(S, r, v0, kappa, theta, xi, rho);
+    EuropeanOption call(K, T, OptionType::Call);
+    EuropeanOption put(K, T, OptionType::Put);
+    std::size_t n_paths = 200'000;
+    std::size_t n_steps = 32;
+
+    double call_analytic = heston_price(
+        S, K, r, v0, kappa, theta, xi, rho, T, OptionType::Call
+    );
+    double put_analytic = heston_price(
+        S, K, r, v0, kappa, theta, xi, rho, T, OptionType::Put
+    );
+
+    RandomEngine call_rng(1310);
+    OnlineStatistics call_results = price_heston(
+        model, call, n_paths, n_steps, call_rng
+    );
+    RandomEngine put_rng(1310);
+    OnlineStatistics put_results = price_heston(
+        model, put, n_paths, n_steps, put_rng
+    );
+
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << "\n============ Heston QE Validation ============" << '\n';
+    print_row(" Steps per path:", n_steps);
+    print_row(" Number of Paths:", n_paths);
+    std::cout << '\n';
+    bool call_ok = print_result("Heston call", call_results, discount(T), call_analytic);
+    bool put_ok = print_result("Heston put", put_results, discount(T), put_analytic);
+
+    double gap = parity_gap(HestonModel(S, 0.03, v0, kappa, theta, xi, rho), T);
+    double bs_gap = black_scholes_limit_gap(T);
+    bool reference_ok = std::abs(call_analytic - 5.785155450) < 1e-6;
+    std::cout << std::scientific << std::setprecision(2);
+    print_row(" Put-call parity gap:", gap);
+    print_row(" BS limit gap:", bs_gap);
+    print_row(" Reference call error:", std::abs(call_analytic - 5.785155450));
+
+    return call_ok && put_ok && gap < 1e-8 && bs_gap < 1e-3 && reference_ok ? 0 : 1;
+}
+
+OnlineStatistics price_heston(
+    const HestonModel& model, 
+    const Option& option, 
+    std::size_t n_paths, 
+    std::size_t n_steps, 
+    RandomEngine& rng
+)
+{
+    OnlineStatistics stats;
+    HestonPathBlock paths(4096);
+
+    for (std::size_t done = 0; done < n_paths; done += paths.size())
+    {
+        model.simulate_block(option.maturity(), n_steps, rng, paths);
+        std::size_t n = std::min(paths.size(), n_paths - done);
+        for (std::size_t i = 0; i < n; ++i)
+            stats.add(option.payoff(std::exp(paths.log_spot[i])));
+    }
+    return stats;
+}
+
+bool print_result(
+    std::string_view name, 
+    const OnlineStatistics& result, 
+    double discount, 
+    double analytic
+)
+{
+    double price = discount * result.mean(); 
+    double se = discount * result.standard_error();
+
+    std::cout << name << " Results" << '\n';
+    std::cout << "------------------------------------------------" << '\n';
+    print_row(" Semi-analytic Price:", analytic);
+    print_row(" Simulated Price:", price); 
+    print_row(" Standard Error:", se);
+    print_row(" Absolute Error:", std::abs(analytic - price));
+    print_row(" z-score vs analytic:", (price - analytic) / se); 
+    std::cout << '\n';
+    return std::abs(price - analytic) < 4.0 * se;
+}
+
+double parity_gap(const HestonModel& model, double maturity)
+{
+    double S = model.spot();
+    double r = model.rate();
+    double worst = 0.0;
+    for (double K : {80.0, 100.0, 125.0})
+    {
+        auto price = [&](OptionType type) {
+            return heston_price(S, K, r, model.v0(), model.kappa(), model.theta(), 
+                                model.xi(), model.rho(), maturity, type);
+        };
+        double forward_value = S - K * std::exp(-r * maturity);
+        double gap = price(OptionType::Call) - price(OptionType::Put) - forward_value;
+        worst = std::max(worst, std::abs(gap));
+    }
+    return worst;
+}
+
+double black_scholes_limit_gap(double maturity)
+{
+    // The gap is first order in xi, about 2e-4 here
+    double worst = 0.0;
+    for (double K : {80.0, 100.0, 125.0})
+    {
+        double heston = heston_price(
+            100.0, K, 0.03, 0.04, 1.5, 0.04, 1e-4, -0.5, maturity, OptionType::Call);
+        double bs = black_scholes_price(100.0, K, 0.03, 0.2, maturity, OptionType::Call);
+        worst = std::max(worst, std::abs(heston - bs));
+    }
+    return worst;
+}
@@ -0,0 +1,71 @@
+#include "models/BlackScholesModel.hpp"
+#include "options/BermudanOption.hpp"
+#include "market/FlatDiscount.hpp"
+#include "core/LongstaffSchwartzPricer.hpp"
+#include "analytics/BlackScholesClosedForm.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+/// True if constructing a put on the given dates throws invalid_argument.
+bool rejected(std::vector<double> dates);
+
+int main()
+{
+    // Longstaff & Schwartz (2001) Table 1: S=36, sigma=0.2, T=1, finite 
+    // difference American value 4.478; 50 exercise dates per year
+    double S = 36.0;
+    double r = 0.06;
+    double v = 0.2;
+    double T = 1.0;
+    double K = 40.0;
+    double reference = 4.478;
+
+    FlatDiscount discount(r);
+    BlackScholesModel model(S, r, v);
+    BermudanOption put = BermudanOption::american(K, T, 50, OptionType::Put);
+    LongstaffSchwartzPricer pricer(model, put, discount);
+    LsmResult result = pricer.price(200'000, 200'000);
+
+    // Fifty dates and a quadratic basis converge to about 4.465, a little 
+    // below the American value, so 0.02 of bias is allowed on top of the noise
+    double error = result.price - reference;
+    bool price_ok = std::abs(error) < 0.02 + 3.0 * result.standard_error;
+    double european = black_scholes_price(S, K, r, v, T, OptionType::Put);
+    bool premium_ok = result.price > european;
+
+    bool dates_ok = rejected({0.5, 0.5, 1.0}) 
+                    && rejected({0.5, 0.25, 1.0}) 
+                    && rejected({0.0, 0.5, 1.0}) 
+                    && rejected({});
+
+    std::cout << std::setprecision(6);
+    std::cout << "============ Longstaff-Schwartz Results ============" << '\n';
+    print_row(" LSM price:", result.price);
+    print_row(" Std error:", result.standard_error);
+    print_row(" LS (2001) reference:", reference);
+    print_row(" European put:", european);
+    print_row(" Invalid dates:", dates_ok ? "rejected" : "ACCEPTED");
+
+    return price_ok && premium_ok && dates_ok ? 0 : 1;
+}
+
+bool rejected(std::vector<double> dates)
+{
+    try 
+    {
+        BermudanOption option(40.0, std::move(dates), OptionType::Put);
+    }
+    catch (const std::invalid_argument&)
+    {
+        return true;
+    }
+    return false;
+}
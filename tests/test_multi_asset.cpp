@@ -0,0 +1,150 @@
+#include "models/MultiAssetBlackScholesModel.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/BasketOption.hpp"
+#include "options/SpreadOption.hpp"
+#include "options/WorstOfOption.hpp"
+#include "options/EuropeanOption.hpp"
+#include "samplers/MCSampler.hpp"
+#include "market/FlatDiscount.hpp"
+#include "core/MultiAssetEngine.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/RandomEngine.hpp"
+#include "analytics/BlackScholesClosedForm.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+int main()
+{
+    double r = 0.05;
+    double T = 1.0;
+    FlatDiscount discount(r);
+    bool ok = true;
+
+    std::cout << std::setprecision(6);
+    std::cout << "============ Multi-Asset Results ============" << '\n';
+
+    // One asset: the basket engine must reduce to the single-asset engine
+    {
+        std::size_t n_paths = 200'000;
+        MultiAssetBlackScholesModel model({100.0}, r, {0.2}, {1.0});
+        BasketOption basket({1.0}, 100.0, T, OptionType::Call);
+        RandomEngine rng(1310);
+        OnlineStatistics stats = MultiAssetEngine(model, basket).run(n_paths, rng);
+        double price = discount(T) * stats.mean();
+        double se = discount(T) * stats.standard_error();
+
+        BlackScholesModel single(100.0, r, 0.2);
+        EuropeanOption call(100.0, T, OptionType::Call);
+        MCSampler sampler(single, call);
+        RandomEngine mc_rng(1310);
+        OnlineStatistics mc = MonteCarloEngine(sampler).run(n_paths, mc_rng);
+
+        double analytic = black_scholes_price(100.0, 100.0, r, 0.2, T, OptionType::Call);
+        bool engine_match = std::abs(stats.mean() - mc.mean()) < 1e-12 * mc.mean();
+        bool within = std::abs(price - analytic) < 4.0 * se;
+        print_row(" One-asset price:", price);
+        print_row(" Analytic price:", analytic);
+        print_row(" Std error:", se);
+        print_row(" vs MonteCarloEngine:", engine_match ? "match" : "MISMATCH");
+        ok = ok && engine_match && within;
+    }
+
+    // Four assets: empirical correlation of the log returns and forward drift
+    {
+        const std::size_t d = 4, n_paths = 200'000;
+        std::vector<double> correlation = {
+            1.0,  0.6,  0.3, -0.2,
+            0.6,  1.0,  0.5,  0.0,
+            0.3,  0.5,  1.0,  0.4,
+           -0.2,  0.0,  0.4,  1.0
+        };
+        std::vector<double> spots = {100.0, 50.0, 80.0, 120.0};
+        std::vector<double> vols = {0.2, 0.3, 0.25, 0.15};
+        MultiAssetBlackScholesModel model(spots, r, vols, correlation);
+
+        RandomEngine rng(1310);
+        std::vector<double> Z(n_paths * d), W(n_paths * d);
+        rng.fill(Z.data(), Z.size());
+        model.correlate(Z.data(), W.data(), n_paths);
+
+        double worst_corr = 0.0;
+        for (std::size_t i = 0; i < d; ++i)
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                double sij = 0.0, sii = 0.0, sjj = 0.0;
+                for (std::size_t p = 0; p < n_paths; ++p)
+                {
+                    sij += W[p * d + i] * W[p * d + j];
+                    sii += W[p * d + i] * W[p * d + i];
+                    sjj += W[p * d + j] * W[p * d + j];
+                }
+                double rho = sij / std::sqrt(sii * sjj);
+                worst_corr = std::max(worst_corr, std::abs(rho - correlation[i * d + j]));
+            }
+
+        // E[S_i(T)] = S_i exp(rT), tested to four standard errors
+        model.simulate_block(T, W.data(), n_paths);
+        bool drift_ok = true;
+        for (std::size_t i = 0; i < d; ++i)
+        {
+            OnlineStatistics terminal;
+            for (std::size_t p = 0; p < n_paths; ++p)
+                terminal.add(W[p * d + i]);
+            double forward = spots[i] / discount(T);
+            drift_ok = drift_ok
+                && std::abs(terminal.mean() - forward) < 4.0 * terminal.standard_error();
+        }
+
+        // Sampling error of a correlation estimate is about 1 / sqrt(n)
+        print_row(" Max corr error:", worst_corr);
+        print_row(" Forward drift:", drift_ok ? "within 4 SE" : "OUTSIDE 4 SE");
+        ok = ok && worst_corr < 5.0 / std::sqrt(static_cast<double>(n_paths)) && drift_ok;
+    }
+
+    // Options reading past the model's assets are rejected, subsets are not
+    {
+        MultiAssetBlackScholesModel model(
+            {100.0, 50.0}, r, {0.2, 0.3}, {1.0, 0.5, 0.5, 1.0});
+        BasketOption wide_basket({0.4, 0.3, 0.3}, 100.0, T, OptionType::Call);
+        SpreadOption wide_spread(0, 2, 0.0, T, OptionType::Call);
+        WorstOfOption wide_worst({100.0, 50.0, 80.0}, 1.0, T, OptionType::Put);
+        SpreadOption spread(1, 0, 0.0, T, OptionType::Call);
+
+        int rejected = 0;
+        for (const MultiAssetOption* option : 
+             std::initializer_list<const MultiAssetOption*>{&wide_basket, &wide_spread, &wide_worst})
+        {
+            try
+            {
+                MultiAssetEngine engine(model, *option);
+            }
+            catch (const std::invalid_argument&)
+            {
+                ++rejected;
+            }
+        }
+        bool accepted = true;
+        try
+        {
+            MultiAssetEngine engine(model, spread);
+        }
+        catch (const std::invalid_argument&)
+        {
+            accepted = false;
+        }
+        print_row(" Too many assets:", rejected == 3 ? "rejected" : "ACCEPTED");
+        ok = ok && rejected == 3 && accepted;
+    }
+
+    return ok ? 0 : 1;
+}
\ No newline at end of file
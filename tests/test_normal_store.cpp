@@ -0,0 +1,101 @@
+#include "samplers/MCSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/NormalStore.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <cstdio>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+bool identical(const OnlineStatistics& a, const OnlineStatistics& b);
+
+/// True if opening path throws a runtime_error.
+bool rejected(const std::string& path);
+
+int main()
+{
+    BlackScholesModel model(100.0, 0.05, 0.2);
+    EuropeanOption call(100.0, 1.0, OptionType::Call);
+    MCSampler sampler(model, call);
+
+    // Not a multiple of the engine block so the last block is partial
+    const std::size_t n_paths = 50'001;
+    const std::string file = "test_normal_store.bin";
+    write_normal_store(file, n_paths, 1310);
+
+    MappedNormalStore store(file);
+    RandomEngine rng(1310);
+    bool draws_match = store.size() == n_paths && store.seed() == 1310;
+    for (std::size_t i = 0; i < n_paths; ++i)
+        draws_match = draws_match && store.normal() == rng.normal();
+
+    // Two engines over the same store, and one over the generator itself
+    MonteCarloEngine engine(sampler);
+    store.seek(0);
+    OnlineStatistics first = engine.run(n_paths, store);
+    MappedNormalStore other(file);
+    OnlineStatistics second = MonteCarloEngine(sampler).run(n_paths, other);
+    RandomEngine replay(1310);
+    OnlineStatistics direct = engine.run(n_paths, replay);
+    bool engines_match = identical(first, second) && identical(first, direct);
+
+    bool exhausted = false;
+    try
+    {
+        store.normal();
+    }
+    catch (const std::out_of_range&)
+    {
+        exhausted = true;
+    }
+
+    // Trailing partial double and a missing payload tail
+    const std::string damaged = "test_normal_store_damaged.bin";
+    bool truncation_caught = true;
+    for (std::ptrdiff_t delta : {3, -8, -5})
+    {
+        std::ifstream in(file, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        bytes.resize(static_cast<std::size_t>(static_cast<std::ptrdiff_t>(bytes.size()) + delta));
+        std::ofstream(damaged, std::ios::binary | std::ios::trunc) << bytes;
+        truncation_caught = truncation_caught && rejected(damaged);
+    }
+
+    std::cout << "============ Normal Store Results ============" << '\n';
+    print_row(" Draws stored:", store.size());
+    print_row(" Draws replay:", draws_match ? "identical" : "MISMATCH");
+    print_row(" Engine runs:", engines_match ? "identical" : "MISMATCH");
+    print_row(" Exhaustion:", exhausted ? "thrown" : "MISSED");
+    print_row(" Truncation:", truncation_caught ? "rejected" : "ACCEPTED");
+    std::remove(file.c_str());
+    std::remove(damaged.c_str());
+
+    return draws_match && engines_match && exhausted && truncation_caught ? 0 : 1;
+}
+
+bool identical(const OnlineStatistics& a, const OnlineStatistics& b)
+{
+    return a.count() == b.count() && a.mean() == b.mean() && a.m2() == b.m2();
+}
+
+bool rejected(const std::string& path)
+{
+    try
+    {
+        MappedNormalStore store(path, false);
+    }
+    catch (const std::runtime_error&)
+    {
+        return true;
+    }
+    return false;
+}
\ No newline at end of file
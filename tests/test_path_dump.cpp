@@ -0,0 +1,113 @@
+#include "samplers/FusedControlSampler.hpp"
+#include "samplers/FusedAntitheticControlSampler.hpp"
+#include "samplers/AntitheticSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/PathDump.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdio>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+int main()
+{
+    BlackScholesModel model(100.0, 0.05, 0.2); 
+    EuropeanOption call(105.0, 1.0, OptionType::Call);
+    EuropeanOption control(100.0, 1.0, OptionType::Call);
+    FusedControlSampler sampler(model, call, control, 10.45, 0.9);
+
+    // Chunk size does not divide the engine block or the path count
+    const std::size_t n_paths = 100'003;
+    const std::string file = "test_path_dump.bin";
+    OnlineStatistics stats;
+    {
+        MonteCarloEngine engine(sampler); 
+        PathDumpWriter writer(file, sampler, 10'000, 2);
+        engine.attach(writer);
+        RandomEngine rng(1310);
+        stats = engine.run(n_paths, rng);
+        writer.close();
+    }
+
+    PathDumpReader reader(file);
+    RandomEngine rng(1310);
+    OnlineStatistics replayed;
+    bool draws_match = true; 
+    bool records_match = true;
+    for (std::size_t c = 0; c < reader.n_chunks(); ++c)
+    {
+        const double* Z = reader.column(c, PathColumn::Z);
+        const double* ST = reader.column(c, PathColumn::Terminal);
+        const double* X = reader.column(c, PathColumn::Payoff);
+        const double* Y = reader.column(c, PathColumn::Control);
+        for (std::size_t i = 0; i < reader.chunk_size(c); ++i)
+        {
+            draws_match = draws_match && Z[i] == rng.normal();
+            records_match = records_match 
+                && ST[i] == model.simulate(1.0, Z[i])
+                && X[i] == call.payoff(ST[i]) 
+                && Y[i] == control.payoff(ST[i]);
+            replayed.add(X[i] - 0.9 * (Y[i] - 10.45));
+        }
+    }
+    bool means_match = replayed.count() == stats.count() && replayed.mean() == stats.mean();
+
+    // Samplers without per-path records would dump NaN terminal prices
+    AntitheticSampler anti(model, call);
+    FusedAntitheticControlSampler anti_cv(model, call, control, 10.45, 0.9);
+    int rejected = 0;
+    for (const PathSampler* unrecorded : {
+        static_cast<const PathSampler*>(&anti), 
+        static_cast<const PathSampler*>(&anti_cv)})
+    {
+        try 
+        {
+            PathDumpWriter bad("test_path_dump_rejected.bin", *unrecorded);
+        }
+        catch (const std::invalid_argument&)
+        {
+            ++rejected;
+        }
+    }
+
+    // Trailing partial double and a missing payload tail
+    const std::string damaged = "test_path_dump_damaged.bin";
+    bool truncation_caught = true;
+    for (std::ptrdiff_t delta : {3, -8, -5})
+    {
+        std::ifstream in(file, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        bytes.resize(static_cast<std::size_t>(static_cast<std::ptrdiff_t>(bytes.size()) + delta));
+        std::ofstream(damaged, std::ios::binary | std::ios::trunc) << bytes;
+        try 
+        {
+            PathDumpReader bad(damaged);
+            truncation_caught = false;
+        }
+        catch (const std::runtime_error&) {}
+    }
+    std::remove(damaged.c_str());
+
+    std::cout << "============ Path Dump Results ============" << '\n';
+    print_row(" Paths written:", reader.size());
+    print_row(" Chunks:", reader.n_chunks());
+    print_row(" Draws replay:", draws_match ? "identical" : "MISMATCH");
+    print_row(" Records:", records_match ? "identical" : "MISMATCH");
+    print_row(" Estimator mean:", means_match ? "identical" : "MISMATCH");
+    print_row(" Antithetic samplers:", rejected == 2 ? "rejected" : "ACCEPTED");
+    print_row(" Truncation:", truncation_caught ? "rejected" : "ACCEPTED");
+    std::remove(file.c_str());
+
+    return reader.size() == n_paths && draws_match && records_match && means_match 
+           && rejected == 2 && truncation_caught ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+#include "samplers/MCSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "options/DigitalOption.hpp"
+#include "options/ScriptedOption.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/ScriptedEngine.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(30) << label << value << '\n';
+};
+
+bool same_price(
+    const BlackScholesModel& model, 
+    const Option& option, 
+    const ScriptedOption& scripted
+);
+
+bool evaluates_to(const std::string& source, double ST, double expected);
+
+bool rejects(const std::string& source);
+
+int main()
+{
+    BlackScholesModel model(100.0, 0.05, 0.2); 
+    bool ok = true;
+    auto check = [&](const std::string& label, bool passed)
+    {
+        print_row(" " + label, passed ? "ok" : "FAILED");
+        ok = ok && passed;
+    };
+
+    std::cout << "============ Payoff Script Results ============" << '\n';
+
+    // Engine prices match the hand-written options bit for bit
+    check("Call vs EuropeanOption:", same_price(model, 
+        EuropeanOption(100.0, 1.0, OptionType::Call), 
+        ScriptedOption("max(ST - 100, 0)", 1.0)));
+    check("Put vs EuropeanOption:", same_price(model, 
+        EuropeanOption(100.0, 1.0, OptionType::Put), 
+        ScriptedOption("max(100 - ST, 0)", 1.0)));
+    check("Digital vs DigitalOption:", same_price(model, 
+        DigitalOption(105.0, 1.0, 10.0, OptionType::Call), 
+        ScriptedOption("10 * (ST > 105)", 1.0)));
+
+    // Precedence, folding, functions and immediates on either side
+    check("Precedence:", evaluates_to("2 + 3 * 4 - 10 / 5", 1.0, 12.0));
+    check("Unary minus:", evaluates_to("-ST + 2 * ST", 7.0, 7.0));
+    check("Constant on the left:", evaluates_to("(120 > ST) + (ST >= 95)", 100.0, 2.0));
+    check("Nested min/max:", evaluates_to("min(ST, 110, max(ST, 120))", 130.0, 110.0));
+    check("if/abs/exp/log:", evaluates_to("if(ST < 100, abs(ST - 100), exp(log(ST)))", 90.0, 10.0));
+    check("Deep stack:", evaluates_to("ST * (ST - (ST * (ST - (ST - 1))))", 3.0, 0.0));
+
+    // Path-dependent script on three dates against a direct evaluation
+    ScriptedOption asian("max((S[0] + S[1] + ST) / 3 - 100, 0)", {1.0 / 3, 2.0 / 3, 1.0});
+    double a[] = {90.0, 101.0}, b[] = {110.0, 103.0}, c[] = {130.0, 99.0};
+    const double* columns[] = {a, b, c};
+    double out[2], scratch[2 * PayoffScript::max_stack_depth];
+    asian.payoff_block(columns, 2, out, scratch);
+    check("Three-date block:", out[0] == 10.0 && out[1] == 1.0);
+    {
+        ScriptedEngine engine(model, asian); 
+        RandomEngine rng(1310);
+        OnlineStatistics stats = engine.run(200'000, rng);
+        print_row(" Asian (3 dates) mean:", stats.mean());
+        check("Asian below European:", stats.mean() > 0.0 && stats.mean() < 10.45 * std::exp(0.05));
+    }
+
+    check("Rejects unknown name:", rejects("max(SX - 100, 0)"));
+    check("Rejects missing paren:", rejects("max(ST - 100, 0"));
+    check("Rejects trailing input:", rejects("ST 100"));
+    bool threw = false;
+    try { ScriptedOption("S[3]", {0.5, 1.0}); } catch (const std::invalid_argument&) { threw = true; }
+    check("Rejects missing dates:", threw);
+
+    return ok ? 0 : 1;
+}
+
+bool same_price(
+    const BlackScholesModel& model, 
+    const Option& option, 
+    const ScriptedOption& scripted
+)
+{
+    MCSampler sampler(model, option); 
+    MonteCarloEngine engine(sampler); 
+    RandomEngine rng(1310);
+    OnlineStatistics expected = engine.run(100'003, rng);
+
+    ScriptedEngine scripted_engine(model, scripted); 
+    RandomEngine scripted_rng(1310);
+    OnlineStatistics actual = scripted_engine.run(100'003, scripted_rng);
+    return expected.mean() == actual.mean() && expected.m2() == actual.m2();
+}
+
+bool evaluates_to(const std::string& source, double ST, double expected)
+{
+    return std::abs(ScriptedOption(source, 1.0).payoff(ST) - expected) < 1e-12;
+}
+
+bool rejects(const std::string& source)
+{
+    try 
+    {
+        PayoffScript script(source);
+    }
+    catch (const std::invalid_argument&)
+    {
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,116 @@
+#include "core/PricingContext.hpp"
+#include "samplers/MCSampler.hpp"
+#include "samplers/ControlSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "options/NoOption.hpp"
+#include "market/FlatDiscount.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Counts every heap allocation in the process
+static std::atomic<std::size_t> allocations{0};
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+/// The quote ControlSampler gives with the context's beta on the same draws.
+PricingQuote control_sampler_quote(const PricingRequest& request, double beta, unsigned int seed);
+
+int main()
+{
+    std::vector<PricingRequest> requests = {
+        {100.0, 100.0, 0.2, 0.05, 1.0, OptionType::Call, 50'000}, 
+        {100.0, 90.0, 0.3, 0.02, 0.5, OptionType::Put, 50'000}, 
+        // Deep in the money at low volatility, where raw second moments 
+        // dwarf the variance
+        {100.0, 40.0, 0.05, 0.05, 2.0, OptionType::Call, 50'000}
+    };
+    bool ok = true;
+
+    std::cout << std::setprecision(8);
+    std::cout << "============ Pricing Context Results ============" << '\n';
+
+    // A fresh context prices from the head of RandomEngine(seed)
+    for (const PricingRequest& request : requests)
+    {
+        PricingContext context(1310);
+        PricingQuote quote = context.price(request);
+        PricingQuote reference = control_sampler_quote(request, quote.beta, 1310);
+
+        bool price_ok = std::abs(quote.price - reference.price) < 1e-10 * request.spot;
+        bool se_ok = std::abs(quote.standard_error - reference.standard_error) 
+                     < 1e-6 * reference.standard_error + 1e-12 * request.spot;
+        print_row(" Context price:", quote.price);
+        print_row(" ControlSampler price:", reference.price);
+        print_row(" Context std err:", quote.standard_error);
+        print_row(" ControlSampler std err:", reference.standard_error);
+        ok = ok && price_ok && se_ok;
+    }
+
+    // After warm-up, neither pooled nor inline draws touch the heap
+    PricingContext context(1310, 1 << 14);
+    for (const PricingRequest& request : requests)
+        context.price(request);
+    context.replenish();
+
+    std::size_t before = allocations.load();
+    volatile double sink = 0.0;
+    for (int k = 0; k < 100; ++k)
+    {
+        for (const PricingRequest& request : requests)
+            sink = sink + context.price(request).price;
+        if (k % 2 == 0)
+            context.replenish();
+    }
+    std::size_t allocated = allocations.load() - before;
+    print_row(" Allocs after warm-up:", allocated);
+
+    return ok && allocated == 0 ? 0 : 1;
+}
+
+PricingQuote control_sampler_quote(const PricingRequest& request, double beta, unsigned int seed)
+{
+    BlackScholesModel model(request.spot, request.rate, request.volatility);
+    EuropeanOption option(request.strike, request.maturity, request.type);
+    NoOption underlying(request.maturity);
+    FlatDiscount discount(request.rate);
+    double forward = request.spot / discount(request.maturity);
+
+    ControlSampler sampler(
+        std::make_unique<MCSampler>(model, option), 
+        std::make_unique<MCSampler>(model, underlying), 
+        forward, 
+        beta
+    );
+    RandomEngine rng(seed);
+    OnlineStatistics stats = MonteCarloEngine(sampler).run(request.n_paths, rng);
+    return {
+        discount(request.maturity) * stats.mean(), 
+        discount(request.maturity) * stats.standard_error(), 
+        beta
+    };
+}
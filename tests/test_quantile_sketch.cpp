@@ -0,0 +1,106 @@
+#include "samplers/MCSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/QuantileSketch.hpp"
+#include "core/RandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+/// Largest gap between q and the exact rank of the sketch's q-quantile.
+double worst_rank_error(const QuantileSketch& sketch, const std::vector<double>& sorted);
+
+int main()
+{
+    BlackScholesModel model(100.0, 0.05, 0.2);
+    EuropeanOption call(100.0, 1.0, OptionType::Call);
+    MCSampler sampler(model, call);
+    MonteCarloEngine engine(sampler);
+
+    // Bound for the default k = 200 at 99% confidence
+    const double bound = 0.0165;
+    const std::size_t n_paths = 1'000'000;
+
+    // Terminal prices rather than payoffs: the call payoff has a large 
+    // atom at zero where every low quantile is exact
+    RandomEngine rng(1310);
+    std::vector<double> exact(n_paths);
+    for (double& x : exact)
+        x = model.simulate(1.0, rng.normal());
+
+    QuantileSketch whole;
+    std::vector<QuantileSketch> parts(4, QuantileSketch(200, 7));
+    for (std::size_t i = 0; i < n_paths; ++i)
+    {
+        whole.add(exact[i]);
+        parts[i % parts.size()].add(exact[i]);
+    }
+    for (std::size_t p = 1; p < parts.size(); ++p)
+        parts[0].merge(parts[p]);
+    std::sort(exact.begin(), exact.end());
+
+    double whole_error = worst_rank_error(whole, exact);
+    double merged_error = worst_rank_error(parts[0], exact);
+    bool extremes = whole.min() == exact.front() && whole.max() == exact.back()
+                    && parts[0].min() == exact.front() && parts[0].max() == exact.back();
+    bool counts = whole.count() == n_paths && parts[0].count() == n_paths;
+
+    // Every engine entry point feeds attached observers
+    const std::size_t n_engine = 100'003;
+    QuantileSketch from_run, from_matched, from_async;
+    engine.attach(from_run);
+    RandomEngine run_rng(1310);
+    engine.run(n_engine, run_rng);
+    engine.detach(from_run);
+
+    engine.attach(from_matched);
+    RandomEngine matched_rng(1310);
+    engine.run_moment_matched(n_engine, matched_rng);
+    engine.detach(from_matched);
+
+    engine.attach(from_async);
+    RandomEngine async_rng(1310);
+    engine.run_async(n_engine, async_rng).get();
+    engine.detach(from_async);
+
+    bool observed = from_run.count() == n_engine && from_matched.count() == n_engine
+                    && from_async.count() == n_engine
+                    && from_async.quantile(0.5) == from_run.quantile(0.5);
+
+    std::cout << std::setprecision(6);
+    std::cout << "============ Quantile Sketch Results ============" << '\n';
+    print_row(" Samples:", n_paths);
+    print_row(" Retained:", whole.retained());
+    print_row(" Rank error:", whole_error);
+    print_row(" Merged rank error:", merged_error);
+    print_row(" Bound:", bound);
+    print_row(" Min/max:", extremes ? "exact" : "WRONG");
+    print_row(" Engine observers:", observed ? "notified" : "MISSED");
+
+    return whole_error < bound && merged_error < bound && extremes && counts && observed ? 0 : 1;
+}
+
+double worst_rank_error(const QuantileSketch& sketch, const std::vector<double>& sorted)
+{
+    double worst = 0.0;
+    for (int i = 1; i < 100; ++i)
+    {
+        double q = i / 100.0;
+        double estimate = sketch.quantile(q);
+        double lower = static_cast<double>(
+            std::lower_bound(sorted.begin(), sorted.end(), estimate) - sorted.begin()) / sorted.size();
+        double upper = static_cast<double>(
+            std::upper_bound(sorted.begin(), sorted.end(), estimate) - sorted.begin()) / sorted.size();
+        double error = q < lower ? lower - q : q > upper ? q - upper : 0.0;
+        worst = std::max(worst, error);
+    }
+    return worst;
+}
@@ -0,0 +1,277 @@
+#include "samplers/MCSampler.hpp"
+#include "samplers/AntitheticSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "market/FlatDiscount.hpp"
+#include "core/ShardedRun.hpp"
+#include "core/MonteCarloEngine.hpp"
+#include "core/StreamRandomEngine.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+bool identical(const OnlineStatistics& a, const OnlineStatistics& b);
+
+/// Runs every shard in process and merges them.
+OnlineStatistics run_in_process(
+    const PathSampler& sampler, 
+    std::uint64_t seed, 
+    ShardPlan plan
+);
+
+/// Launches option_pricer once per shard and merges the files they write.
+OnlineStatistics run_in_processes(
+    const std::string& option_pricer, 
+    std::uint64_t seed, 
+    ShardPlan plan
+);
+
+/// Writes shard 0 with the mc sampler and shard 1 with the antithetic one 
+/// through option_pricer; true if merging them is rejected.
+bool rejects_mixed_samplers(
+    const std::string& option_pricer, 
+    std::uint64_t seed, 
+    ShardPlan plan
+);
+
+/// Runs option_pricer on one shard without --out and parses the price it 
+/// prints; NaN if the process fails.
+double price_lone_shard(
+    const std::string& option_pricer, 
+    std::uint64_t seed, 
+    ShardPlan plan, 
+    std::uint64_t shard
+);
+
+/// Usage: test_sharded_run [path/to/option_pricer]
+int main(int argc, char** argv)
+{
+    BlackScholesModel model(100.0, 0.05, 0.2); 
+    EuropeanOption put(100.0, 1.0, OptionType::Put);
+    MCSampler mc_sampler(model, put); 
+    AntitheticSampler anti_sampler(model, put);
+
+    // Last block is partial so uneven shard splits are exercised
+    ShardPlan plan{250'000, 1, 16'384};
+    std::uint64_t seed = 1310;
+    bool ok = true;
+
+    std::cout << "============ Sharded Run Results ============" << '\n';
+    print_row(" Number of Paths:", plan.n_paths);
+    print_row(" Block Size:", plan.block_size);
+    std::cout << '\n';
+
+    for (const PathSampler* sampler : {
+        static_cast<const PathSampler*>(&mc_sampler), 
+        static_cast<const PathSampler*>(&anti_sampler)})
+    {
+        // The reference is the sharded fold with a single shard; the plain 
+        // engine folds path by path rather than block by block, so it agrees 
+        // with the reference to rounding only
+        OnlineStatistics single = run_in_process(*sampler, seed, plan);
+        std::cout << (sampler == &mc_sampler ? "MCSampler" : "AntitheticSampler") 
+                  << " mean " << std::setprecision(17) << single.mean() << '\n';
+
+        StreamRandomEngine stream(seed);
+        OnlineStatistics engine = MonteCarloEngine(*sampler).run(plan.n_paths, stream);
+        bool engine_match = engine.count() == single.count() 
+            && std::abs(engine.mean() - single.mean()) < 1e-12 * std::abs(single.mean()) 
+            && std::abs(engine.m2() - single.m2()) < 1e-10 * single.m2();
+        print_row(" MonteCarloEngine::run:", engine_match ? "match" : "MISMATCH");
+        ok = ok && engine_match;
+
+        for (std::uint64_t n_shards : {2, 3, 7, 16})
+        {
+            ShardPlan sharded = plan; 
+            sharded.n_shards = n_shards;
+            bool match = identical(single, run_in_process(*sampler, seed, sharded));
+            print_row(" " + std::to_string(n_shards) + " shards:", 
+                      match ? "identical" : "MISMATCH");
+            ok = ok && match;
+        }
+        std::cout << '\n';
+    }
+
+    // Shards priced with different discount factors cannot be merged
+    ShardPlan halves = plan; 
+    halves.n_shards = 2;
+    bool discount_rejected = false;
+    try 
+    {
+        merge_shards({
+            run_shard(mc_sampler, seed, halves, 0, 0.95), 
+            run_shard(mc_sampler, seed, halves, 1, 0.96)
+        });
+    }
+    catch (const std::invalid_argument&)
+    {
+        discount_rejected = true;
+    }
+    print_row(" Mixed discounts:", discount_rejected ? "rejected" : "ACCEPTED");
+    ok = ok && discount_rejected;
+
+    // Nor can shards of different samplers or trades, which share the 
+    // seed, plan and discount
+    EuropeanOption other_put(110.0, 1.0, OptionType::Put);
+    MCSampler other_sampler(model, other_put);
+    double df = FlatDiscount(0.05)(1.0);
+    std::uint64_t mc_id = run_identity("mc", 100.0, 100.0, 0.05, 0.2, 1.0, OptionType::Put);
+    std::uint64_t anti_id = run_identity("antithetic", 100.0, 100.0, 0.05, 0.2, 1.0, OptionType::Put);
+    std::uint64_t other_id = run_identity("mc", 100.0, 110.0, 0.05, 0.2, 1.0, OptionType::Put);
+    int identity_rejected = 0;
+    for (const auto& second : {
+        run_shard(anti_sampler, seed, halves, 1, df, anti_id), 
+        run_shard(other_sampler, seed, halves, 1, df, other_id)})
+    {
+        try 
+        {
+            merge_shards({run_shard(mc_sampler, seed, halves, 0, df, mc_id), second});
+        }
+        catch (const std::invalid_argument&)
+        {
+            ++identity_rejected;
+        }
+    }
+    print_row(" Mixed samplers/trades:", identity_rejected == 2 ? "rejected" : "ACCEPTED");
+    ok = ok && identity_rejected == 2;
+
+    if (argc > 1)
+    {
+        OnlineStatistics single = run_in_process(mc_sampler, seed, plan);
+        ShardPlan sharded = plan; 
+        sharded.n_shards = 4;
+        bool match = identical(single, run_in_processes(argv[1], seed, sharded));
+        print_row(" 4 processes:", match ? "identical" : "MISMATCH");
+        ok = ok && match;
+
+        // Without --out a lone shard is priced on its own
+        double discount = FlatDiscount(0.05)(1.0);
+        OnlineStatistics lone = shard_statistics(run_shard(mc_sampler, seed, sharded, 1, discount));
+        bool lone_match = price_lone_shard(argv[1], seed, sharded, 1) == discount * lone.mean();
+        print_row(" Lone shard 1/4:", lone_match ? "identical" : "MISMATCH");
+        ok = ok && lone_match;
+
+        bool cli_rejected = rejects_mixed_samplers(argv[1], seed, halves);
+        print_row(" mc + antithetic files:", cli_rejected ? "rejected" : "ACCEPTED");
+        ok = ok && cli_rejected;
+    }
+
+    return ok ? 0 : 1;
+}
+
+bool identical(const OnlineStatistics& a, const OnlineStatistics& b)
+{
+    return a.count() == b.count() && a.mean() == b.mean() && a.m2() == b.m2();
+}
+
+OnlineStatistics run_in_process(
+    const PathSampler& sampler, 
+    std::uint64_t seed, 
+    ShardPlan plan
+)
+{
+    std::vector<ShardResult> shards;
+    for (std::uint64_t k = 0; k < plan.n_shards; ++k)
+        shards.push_back(run_shard(sampler, seed, plan, k));
+    return merge_shards(shards);
+}
+
+OnlineStatistics run_in_processes(
+    const std::string& option_pricer, 
+    std::uint64_t seed, 
+    ShardPlan plan
+)
+{
+    std::vector<std::string> files;
+    for (std::uint64_t k = 0; k < plan.n_shards; ++k)
+    {
+        std::string file = "test_shard_" + std::to_string(k) + ".bin";
+        std::string command = "\"" + option_pricer + "\""
+            + " --paths " + std::to_string(plan.n_paths) 
+            + " --block " + std::to_string(plan.block_size)
+            + " --seed " + std::to_string(seed) 
+            + " --shard " + std::to_string(k) + "/" + std::to_string(plan.n_shards)
+            + " --out " + file;
+        if (std::system(command.c_str()) != 0)
+            return {};
+        files.push_back(file);
+    }
+
+    std::vector<ShardResult> shards;
+    for (const std::string& file : files)
+    {
+        shards.push_back(read_shard(file));
+        std::remove(file.c_str());
+    }
+    return merge_shards(shards);
+}
+
+bool rejects_mixed_samplers(
+    const std::string& option_pricer, 
+    std::uint64_t seed, 
+    ShardPlan plan
+)
+{
+    std::vector<ShardResult> shards;
+    for (std::uint64_t k = 0; k < 2; ++k)
+    {
+        std::string file = "test_mixed_shard_" + std::to_string(k) + ".bin";
+        std::string command = "\"" + option_pricer + "\""
+            + " --paths " + std::to_string(plan.n_paths) 
+            + " --block " + std::to_string(plan.block_size)
+            + " --seed " + std::to_string(seed) 
+            + " --shard " + std::to_string(k) + "/2"
+            + " --sampler " + (k == 0 ? "mc" : "antithetic")
+            + " --out " + file;
+        if (std::system(command.c_str()) != 0)
+            return false;
+        shards.push_back(read_shard(file));
+        std::remove(file.c_str());
+    }
+
+    try 
+    {
+        merge_shards(shards);
+    }
+    catch (const std::invalid_argument&)
+    {
+        return true;
+    }
+    return false;
+}
+
+double price_lone_shard(
+    const std::string& option_pricer, 
+    std::uint64_t seed, 
+    ShardPlan plan, 
+    std::uint64_t shard
+)
+{
+    std::string command = "\"" + option_pricer + "\""
+        + " --paths " + std::to_string(plan.n_paths) 
+        + " --block " + std::to_string(plan.block_size)
+        + " --seed " + std::to_string(seed) 
+        + " --shard " + std::to_string(shard) + "/" + std::to_string(plan.n_shards);
+
+    FILE* pipe = popen(command.c_str(), "r");
+    if (!pipe)
+        return std::nan("");
+    char line[256] = {};
+    bool read = std::fgets(line, sizeof(line), pipe) != nullptr;
+    if (pclose(pipe) != 0 || !read)
+        return std::nan("");
+
+    // "Price: <p> SE: <se> Paths: <n>"
+    double price; 
+    if (std::sscanf(line, "Price: %lf", &price) != 1)
+        return std::nan("");
+    return price;
+}
\ No newline at end of file
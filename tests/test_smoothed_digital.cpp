@@ -0,0 +1,91 @@
+#include "samplers/SmoothedDigitalSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/DigitalOption.hpp"
+#include "market/FlatDiscount.hpp"
+#include "analytics/BlackScholesClosedForm.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <functional>
+#include <cmath>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+/// E[f(Z)] for standard normal Z by the trapezoid rule on [-10, 10];
+/// deterministic, so smoothing bias is seen without Monte Carlo noise.
+double expectation(const std::function<double(double)>& f);
+
+int main()
+{
+    double S = 100.0;
+    double r = 0.05;
+    double v = 0.2;
+    double T = 1.0;
+    double K = 105.0;
+    double payout = 1.0;
+
+    FlatDiscount discount(r);
+    BlackScholesModel model(S, r, v);
+    DigitalOption digital(K, T, payout, OptionType::Call);
+    auto bs = [&](double spot, double strike) {
+        return black_scholes_digital_price(spot, strike, r, v, T, payout, OptionType::Call);
+    };
+    double exact = bs(S, K) / discount(T);
+    bool ok = true;
+
+    std::cout << std::setprecision(6);
+    std::cout << "============ Smoothed Digital Results ============" << '\n';
+
+    // Conditional expectation is unbiased at any last-step width, and so
+    // is its pathwise delta
+    double h_spot = 1e-3;
+    double exact_delta = (bs(S + h_spot, K) - bs(S - h_spot, K)) / (2.0 * h_spot) / discount(T);
+    for (double width : {0.5, 0.1, 0.01})
+    {
+        SmoothedDigitalSampler sampler(model, digital, DigitalSmoothing::ConditionalExpectation, width);
+        double bias = expectation([&](double Z) { return sampler.sample(Z); }) - exact;
+        double delta = expectation([&](double Z) { return sampler.pathwise_delta(Z); });
+        print_row(" CE dt = " + std::to_string(width).substr(0, 4) + " bias:", bias);
+        ok = ok && std::abs(bias) < 1e-9 && std::abs(delta - exact_delta) < 1e-6;
+    }
+
+    // Kernel bias is -payout * f'(K) * width^2 / 2 to leading order, with f
+    // the terminal density; f' comes from the closed form by differencing
+    double h_K = 1e-2;
+    double density_slope = -(bs(S, K + h_K) - 2.0 * bs(S, K) + bs(S, K - h_K))
+                           / (h_K * h_K) / discount(T);
+    double previous = INFINITY;
+    for (double width : {4.0, 2.0, 1.0, 0.5, 0.25})
+    {
+        SmoothedDigitalSampler sampler(model, digital, DigitalSmoothing::Kernel, width);
+        double bias = expectation([&](double Z) { return sampler.sample(Z); }) - exact;
+        double bound = 0.5 * payout * std::abs(density_slope) * width * width;
+        print_row(" Kernel h = " + std::to_string(width).substr(0, 4) + " bias:", bias);
+        print_row("   leading-order bound:", bound);
+
+        // Shrinking with the width, and within 10% of the leading term
+        // once the higher orders are small
+        ok = ok && std::abs(bias) < previous && std::abs(bias) < 1.1 * bound
+             && (width > 1.0 || std::abs(bias) > 0.9 * bound);
+        previous = std::abs(bias);
+    }
+
+    return ok ? 0 : 1;
+}
+
+double expectation(const std::function<double(double)>& f)
+{
+    const std::size_t n = 200'000;
+    const double a = -10.0, h = 20.0 / n;
+    const double norm = 1.0 / std::sqrt(2.0 * 3.14159265358979323846);
+    double sum = 0.0;
+    for (std::size_t i = 0; i <= n; ++i)
+    {
+        double Z = a + i * h;
+        double w = (i == 0 || i == n) ? 0.5 : 1.0;
+        sum += w * f(Z) * norm * std::exp(-0.5 * Z * Z);
+    }
+    return sum * h;
+}
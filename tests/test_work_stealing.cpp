@@ -0,0 +1,129 @@
+#include "samplers/MCSampler.hpp"
+#include "samplers/AntitheticSampler.hpp"
+#include "samplers/FusedControlSampler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "options/EuropeanOption.hpp"
+#include "options/NoOption.hpp"
+#include "core/WorkStealingScheduler.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+static auto print_row = [](const std::string& label, auto value) {
+    std::cout << std::left << std::setw(25) << label << value << '\n';
+};
+
+/// Sampler that fails once it sees a draw beyond a threshold.
+class ThrowingSampler : public PathSampler
+{
+public:
+    double sample(double Z) const override
+    {
+        if (Z > 3.0)
+            throw std::runtime_error("sampler failed");
+        return Z;
+    }
+};
+
+bool identical(const std::vector<OnlineStatistics>& a, const std::vector<OnlineStatistics>& b);
+
+/// True if the scheduler rethrows a runtime_error from the batch.
+bool rethrows(std::size_t n_threads, std::vector<PricingJob> jobs);
+
+int main()
+{
+    BlackScholesModel model(100.0, 0.05, 0.2);
+    NoOption control(1.0);
+
+    std::vector<EuropeanOption> options;
+    for (int k = 0; k < 8; ++k)
+        options.emplace_back(90.0 + 3.0 * k, 1.0, k % 2 ? OptionType::Put : OptionType::Call);
+
+    // Mixed samplers and sizes, none a multiple of the block
+    std::vector<PricingJob> book;
+    for (std::size_t k = 0; k < options.size(); ++k)
+    {
+        const EuropeanOption& option = options[k];
+        std::uint64_t n_paths = 20'000 + 7'919 * k;
+        if (k % 3 == 0)
+            book.push_back({[&] {
+                return std::make_unique<MCSampler>(model, option);
+            }, n_paths, 1310 + k});
+        else if (k % 3 == 1)
+            book.push_back({[&] {
+                return std::make_unique<AntitheticSampler>(model, option);
+            }, n_paths, 1310 + k});
+        else
+            book.push_back({[&] {
+                return std::make_unique<FusedControlSampler>(model, option, control, 105.13, 0.5);
+            }, n_paths, 1310 + k});
+    }
+
+    std::cout << "============ Work Stealing Results ============" << '\n';
+    print_row(" Jobs:", book.size());
+
+    SchedulerConfig config;
+    config.block_size = 4'096;
+    config.n_threads = 1;
+    std::vector<OnlineStatistics> reference = WorkStealingScheduler(config).run(book);
+
+    bool ok = true;
+    for (std::size_t n_threads : {2, 3, 8})
+    {
+        for (bool steal : {true, false})
+        {
+            config.n_threads = n_threads;
+            config.steal = steal;
+            bool match = identical(reference, WorkStealingScheduler(config).run(book));
+            print_row(" " + std::to_string(n_threads) + " threads" + (steal ? "" : ", no steal") + ":",
+                      match ? "identical" : "MISMATCH");
+            ok = ok && match;
+        }
+    }
+
+    // Failures in setup and in a path block reach the caller
+    std::vector<PricingJob> failing_setup = book;
+    failing_setup[3].make_sampler = []() -> std::unique_ptr<PathSampler> {
+        throw std::runtime_error("setup failed");
+    };
+    std::vector<PricingJob> failing_block = book;
+    failing_block[5].make_sampler = [] { return std::make_unique<ThrowingSampler>(); };
+
+    bool setup_thrown = rethrows(1, failing_setup) && rethrows(4, failing_setup);
+    bool block_thrown = rethrows(1, failing_block) && rethrows(4, failing_block);
+    print_row(" Setup exception:", setup_thrown ? "rethrown" : "LOST");
+    print_row(" Block exception:", block_thrown ? "rethrown" : "LOST");
+
+    return ok && setup_thrown && block_thrown ? 0 : 1;
+}
+
+bool identical(const std::vector<OnlineStatistics>& a, const std::vector<OnlineStatistics>& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        if (a[i].count() != b[i].count() || a[i].mean() != b[i].mean() || a[i].m2() != b[i].m2())
+            return false;
+    }
+    return true;
+}
+
+bool rethrows(std::size_t n_threads, std::vector<PricingJob> jobs)
+{
+    SchedulerConfig config;
+    config.block_size = 4'096;
+    config.n_threads = n_threads;
+    try
+    {
+        WorkStealingScheduler(config).run(jobs);
+    }
+    catch (const std::runtime_error&)
+    {
+        return true;
+    }
+    return false;
+}
\ No newline at end of file